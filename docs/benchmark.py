@@ -1,6 +1,11 @@
 # -*- coding: utf-8 -*-
+import argparse
+import importlib
 import random
 import os
+import subprocess
+import sys
+import sysconfig
 import time
 import datetime as dt
 
@@ -8,7 +13,8 @@ nfns = 4  # Functions per class
 nargs = 4  # Arguments per function
 
 
-def generate_dummy_code_pybind11(nclasses=10):
+def generate_dummy_code_pybind11(nclasses=10, define=False, nmethods=None):
+    nmethods = nfns if nmethods is None else nmethods
     decl = ""
     bindings = ""
 
@@ -20,12 +26,12 @@ def generate_dummy_code_pybind11(nclasses=10):
         decl += "class cl%03i {\n" % cl
         decl += "public:\n"
         bindings += '    py::class_<cl%03i>(m, "cl%03i")\n' % (cl, cl)
-        for fn in range(nfns):
+        for fn in range(nmethods):
             ret = random.randint(0, nclasses - 1)
             params = [random.randint(0, nclasses - 1) for i in range(nargs)]
             decl += "    cl%03i *fn_%03i(" % (ret, fn)
             decl += ", ".join("cl%03i *" % p for p in params)
-            decl += ");\n"
+            decl += ") { return nullptr; }\n" if define else ");\n"
             bindings += '        .def("fn_%03i", &cl%03i::fn_%03i)\n' % (fn, cl, fn)
         decl += "};\n\n"
         bindings += "        ;\n"
@@ -73,20 +79,190 @@ def generate_dummy_code_boost(nclasses=10):
     return result
 
 
-for codegen in [generate_dummy_code_pybind11, generate_dummy_code_boost]:
+def build_module(code, name="example", directory="."):
+    """Compiles the given (pybind11) module source for the running interpreter"""
+    source = os.path.join(directory, name + ".cpp")
+    with open(source, "w") as f:
+        f.write(code.replace("PYBIND11_MODULE(example,", "PYBIND11_MODULE(%s," % name))
+    target = os.path.join(directory, name + sysconfig.get_config_var("EXT_SUFFIX"))
+    flags = ["-undefined", "dynamic_lookup"] if sys.platform == "darwin" else []
+    subprocess.check_call(
+        [os.environ.get("CXX", "c++"), "-O2", "-shared", "-fPIC", "-fvisibility=hidden", "-pthread"]
+        + ["-std=c++14", source, "-I", "include", "-I", sysconfig.get_paths()["include"]]
+        + flags
+        + ["-o", target]
+    )
+    return target
+
+
+def measure_import_time(name, directory=".", repeat=5):
+    """Returns the best time (in seconds) taken to import a module in a fresh interpreter"""
+    code = (
+        "import sys, time; sys.path.insert(0, %r); t = time.perf_counter(); import %s; "
+        "print(time.perf_counter() - t)" % (os.path.abspath(directory), name)
+    )
+    return min(
+        float(subprocess.check_output([sys.executable, "-c", code]))
+        for _ in range(repeat)
+    )
+
+
+def benchmark_compilation():
+    for codegen in [generate_dummy_code_pybind11, generate_dummy_code_boost]:
+        print("{")
+        for i in range(0, 10):
+            nclasses = 2 ** i
+            with open("test.cpp", "w") as f:
+                f.write(codegen(nclasses))
+            n1 = dt.datetime.now()
+            os.system(
+                "g++ -Os -shared -rdynamic -undefined dynamic_lookup "
+                "-fvisibility=hidden -std=c++14 test.cpp -I include "
+                "-I /System/Library/Frameworks/Python.framework/Headers -o test.so"
+            )
+            n2 = dt.datetime.now()
+            elapsed = (n2 - n1).total_seconds()
+            size = os.stat("test.so").st_size
+            print("   {%i, %f, %i}," % (nclasses * nfns, elapsed, size))
+        print("}")
+
+
+def benchmark_import_time():
     print("{")
     for i in range(0, 10):
         nclasses = 2 ** i
-        with open("test.cpp", "w") as f:
-            f.write(codegen(nclasses))
-        n1 = dt.datetime.now()
-        os.system(
-            "g++ -Os -shared -rdynamic -undefined dynamic_lookup "
-            "-fvisibility=hidden -std=c++14 test.cpp -I include "
-            "-I /System/Library/Frameworks/Python.framework/Headers -o test.so"
-        )
-        n2 = dt.datetime.now()
-        elapsed = (n2 - n1).total_seconds()
-        size = os.stat("test.so").st_size
-        print("   {%i, %f, %i}," % (nclasses * nfns, elapsed, size))
+        build_module(generate_dummy_code_pybind11(nclasses, True), "example_import")
+        elapsed = measure_import_time("example_import")
+        print("   {%i, %f}," % (nclasses * nfns, elapsed))
     print("}")
+
+
+def profile_import(name, directory="."):
+    """Prints the slowest steps of the initialization of a module (see pybind11.import_profile)"""
+    root = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..")
+    code = (
+        "import sys; sys.path[:0] = [%r, %r]; "
+        "from pybind11.import_profile import profile_import, format_import_profile; "
+        "print(format_import_profile(profile_import(%r), limit=10))"
+        % (os.path.abspath(directory), root, name)
+    )
+    subprocess.check_call([sys.executable, "-c", code])
+
+
+FIRST_TOUCH_CODE = r"""
+#include <pybind11/numpy.h>
+#include <cstring>
+
+namespace py = pybind11;
+
+PYBIND11_MODULE(example, m) {
+    // A new array, zero-filled by the calling thread or with py::parallel_first_touch
+    m.def("allocate", [](py::ssize_t rows, py::ssize_t cols, bool first_touch) {
+        py::array_t<double> a({rows, cols});
+        if (first_touch)
+            py::parallel_first_touch(a);
+        else
+            std::memset(a.mutable_data(), 0, (size_t) a.nbytes());
+        return a;
+    });
+    // A memory-bound parallel kernel
+    m.def("kernel", [](py::array_t<double> a) {
+        py::parallel_for<2>(a, [](py::detail::unchecked_mutable_reference<double, 2> &rows, py::ssize_t) {
+            for (py::ssize_t i = 0; i < rows.shape(0); i++)
+                for (py::ssize_t j = 0; j < rows.shape(1); j++)
+                    rows(i, j) = 2 * rows(i, j) + 1;
+        });
+    });
+}
+"""
+
+
+def measure_first_touch(name, directory=".", megabytes=1024, repeat=5):
+    """
+    Reports the bandwidth of a parallel kernel on an array zero-filled by one thread, and on one
+    zero-filled with py::parallel_first_touch (which only makes a difference on NUMA machines)
+    """
+    sys.path.insert(0, os.path.abspath(directory))
+    module = importlib.import_module(name)
+    cols = 1024
+    rows = megabytes * 2 ** 20 // (8 * cols)
+    for first_touch in (False, True):
+        t = time.perf_counter()
+        a = module.allocate(rows, cols, first_touch)
+        allocation = time.perf_counter() - t
+        elapsed = []
+        for _ in range(repeat):
+            t = time.perf_counter()
+            module.kernel(a)
+            elapsed.append(time.perf_counter() - t)
+        print(
+            "%-20s allocation %8.2f ms, kernel %8.2f ms (%.1f GB/s)"
+            % (
+                "parallel first touch" if first_touch else "serial first touch",
+                allocation * 1000,
+                min(elapsed) * 1000,
+                2 * a.nbytes / min(elapsed) / 1e9,
+            )
+        )
+        del a
+
+
+def main():
+    parser = argparse.ArgumentParser()
+    parser.add_argument(
+        "--import-time",
+        action="store_true",
+        help="Measure the import time of modules of increasing size.",
+    )
+    parser.add_argument(
+        "--generate",
+        metavar="FILE",
+        help="Write the source of a module with --classes classes of --methods methods.",
+    )
+    parser.add_argument("--classes", type=int, default=256)
+    parser.add_argument("--methods", type=int, default=nfns)
+    parser.add_argument("--name", default="example", help="Name of the module.")
+    parser.add_argument(
+        "--measure",
+        metavar="DIRECTORY",
+        help="Report the import time of the module --name built in a directory.",
+    )
+    parser.add_argument(
+        "--first-touch",
+        action="store_true",
+        help="Compare a parallel kernel on arrays first touched by one or all threads "
+        "(with --generate/--measure: for the module built from the generated source).",
+    )
+    parser.add_argument(
+        "--megabytes",
+        type=int,
+        default=1024,
+        help="Size of the arrays of --first-touch.",
+    )
+    args = parser.parse_args()
+
+    if args.generate:
+        random.seed(0)
+        if args.first_touch:
+            code = FIRST_TOUCH_CODE
+        else:
+            code = generate_dummy_code_pybind11(args.classes, True, args.methods)
+        with open(args.generate, "w") as f:
+            f.write(code.replace("PYBIND11_MODULE(example,", "PYBIND11_MODULE(%s," % args.name))
+    elif args.measure and args.first_touch:
+        measure_first_touch(args.name, args.measure, args.megabytes)
+    elif args.measure:
+        elapsed = measure_import_time(args.name, args.measure)
+        print("Import time of %s: %.3f ms" % (args.name, elapsed * 1000))
+        profile_import(args.name, args.measure)
+    elif args.first_touch:
+        build_module(FIRST_TOUCH_CODE, "example_first_touch")
+        measure_first_touch("example_first_touch", megabytes=args.megabytes)
+    elif args.import_time:
+        benchmark_import_time()
+    else:
+        benchmark_compilation()
+
+
+if __name__ == "__main__":
+    main()
@@ -57,6 +57,18 @@ struct dynamic_attr { };
 /// Annotation which enables the buffer protocol for a type
 struct buffer_protocol { };
 
+/// Annotation which stores instances of a type directly inside the Python object (rather than
+/// in a separately allocated C++ value) whenever pybind11 constructs the value itself
+struct inline_storage { };
+
+/// Annotation which keeps the memory of up to `max_size` destroyed instances of a type for reuse
+/// by new instances (together with py::inline_storage, this includes the C++ value)
+struct free_list { size_t max_size; explicit free_list(size_t max_size = 1024) : max_size(max_size) { } };
+
+/// Annotation which removes support for weak references from a type, making its instances
+/// smaller (types with bound base classes inherit the layout of their bases instead)
+struct no_weakref { };
+
 /// Annotation which requests that a special metaclass is created for a type
 struct metaclass {
     handle value;
@@ -142,7 +154,8 @@ struct function_record {
     function_record()
         : is_constructor(false), is_new_style_constructor(false), is_stateless(false),
           is_operator(false), is_method(false), has_args(false),
-          has_kwargs(false), has_kw_only_args(false), prepend(false) { }
+          has_kwargs(false), has_kw_only_args(false), prepend(false), release_gil(false),
+          show_signatures(true), show_docstrings(true), doc_pending(false) { }
 
     /// Function name
     char *name = nullptr; /* why no C++ strings? They generate heavier code.. */
@@ -153,6 +166,11 @@ struct function_record {
     /// Human-readable version of the function signature
     char *signature = nullptr;
 
+    /// Signature text and argument types, kept until the signature is generated (see
+    /// PYBIND11_DEFERRED_DOCSTRINGS)
+    const char *signature_text = nullptr;
+    std::vector<const std::type_info *> signature_types;
+
     /// List of registered keyword arguments
     std::vector<argument_record> args;
 
@@ -195,6 +213,18 @@ struct function_record {
     /// True if this function is to be inserted at the beginning of the overload resolution chain
     bool prepend : 1;
 
+    /// True if the GIL is released while calling the C++ function (see options::enable_default_gil_release)
+    bool release_gil : 1;
+
+    /// Docstring options (see `options`) in effect when the last overload was added; only used
+    /// by the head of an overload chain
+    bool show_signatures : 1;
+    bool show_docstrings : 1;
+
+    /// True while the docstring of the function object is to be generated at the end of the
+    /// initialization of its module; only used by the head of an overload chain
+    bool doc_pending : 1;
+
     /// Number of arguments (including py::args and/or py::kwargs, if present)
     std::uint16_t nargs;
 
@@ -221,7 +251,8 @@ struct function_record {
 struct type_record {
     PYBIND11_NOINLINE type_record()
         : multiple_inheritance(false), dynamic_attr(false), buffer_protocol(false),
-          default_holder(true), module_local(false), is_final(false) { }
+          default_holder(true), module_local(false), is_final(false), inline_storage(false),
+          no_weakref(false) { }
 
     /// Handle to the parent scope
     handle scope;
@@ -250,6 +281,13 @@ struct type_record {
     /// Function pointer to class_<..>::dealloc
     void (*dealloc)(detail::value_and_holder &) = nullptr;
 
+    /// Number of destroyed instances kept for reuse (py::free_list)
+    size_t free_list_size = 0;
+
+    /// Copy/move constructs a value into inline storage (if copy/move constructible)
+    void (*inline_copy)(void *, const void *) = nullptr;
+    void (*inline_move)(void *, void *) = nullptr;
+
     /// List of base classes of the newly created type
     list bases;
 
@@ -277,6 +315,12 @@ struct type_record {
     /// Is the class inheritable from python classes?
     bool is_final : 1;
 
+    /// Are values stored inside the Python instance (py::inline_storage)?
+    bool inline_storage : 1;
+
+    /// Do instances lack support for weak references (py::no_weakref)?
+    bool no_weakref : 1;
+
     PYBIND11_NOINLINE void add_base(const std::type_info &base, void *(*caster)(void *)) {
         auto base_info = detail::get_type_info(base, false);
         if (!base_info) {
@@ -468,6 +512,21 @@ struct process_attribute<is_final> : process_attribute_default<is_final> {
     static void init(const is_final &, type_record *r) { r->is_final = true; }
 };
 
+template <>
+struct process_attribute<inline_storage> : process_attribute_default<inline_storage> {
+    static void init(const inline_storage &, type_record *r) { r->inline_storage = true; }
+};
+
+template <>
+struct process_attribute<no_weakref> : process_attribute_default<no_weakref> {
+    static void init(const no_weakref &, type_record *r) { r->no_weakref = true; }
+};
+
+template <>
+struct process_attribute<free_list> : process_attribute_default<free_list> {
+    static void init(const free_list &f, type_record *r) { r->free_list_size = f.max_size; }
+};
+
 template <>
 struct process_attribute<buffer_protocol> : process_attribute_default<buffer_protocol> {
     static void init(const buffer_protocol &, type_record *r) { r->buffer_protocol = true; }
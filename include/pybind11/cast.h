@@ -15,6 +15,7 @@
 #include "detail/descr.h"
 #include "detail/internals.h"
 #include <array>
+#include <functional>
 #include <limits>
 #include <tuple>
 #include <type_traits>
@@ -50,10 +51,18 @@ public:
 
     /// ... and destroyed after it returns
     ~loader_life_support() {
-        auto &stack = get_internals().loader_patient_stack;
+        auto &internals = get_internals();
+        auto &stack = internals.loader_patient_stack;
         if (stack.empty())
             pybind11_fail("loader_life_support: internal error");
 
+        auto &temporaries = internals.loader_temporaries;
+        while (!temporaries.empty() && temporaries.back().frame == stack.size()) {
+            auto temporary = temporaries.back();
+            temporaries.pop_back();
+            temporary.destroy(temporary.value);
+        }
+
         auto ptr = stack.back();
         stack.pop_back();
         Py_CLEAR(ptr);
@@ -84,6 +93,19 @@ public:
                 pybind11_fail("loader_life_support: error adding patient");
         }
     }
+
+    /// Like `add_patient`, but for a C++ value which is destroyed with `destroy(value)`
+    PYBIND11_NOINLINE static void add_temporary(void *value, void (*destroy)(void *)) {
+        auto &internals = get_internals();
+        auto frame = internals.loader_patient_stack.size();
+        if (frame == 0) {
+            destroy(value);
+            throw cast_error("When called outside a bound function, py::cast() cannot "
+                             "do Python -> C++ conversions which require the creation "
+                             "of temporary values");
+        }
+        internals.loader_temporaries.push_back({frame, value, destroy});
+    }
 };
 
 // Gets the cache entry for the given type, creating it if necessary.  The return value is the pair
@@ -156,6 +178,18 @@ inline const std::vector<detail::type_info *> &all_type_info(PyTypeObject *type)
     return ins.first->second;
 }
 
+/// Like `all_type_info`, but doesn't add a cache entry (and the weak reference to the type that
+/// comes with it) for types which don't have one yet.
+inline std::vector<detail::type_info *> all_type_info_lookup(PyTypeObject *type) {
+    auto const &type_dict = get_internals().registered_types_py;
+    auto it = type_dict.find(type);
+    if (it != type_dict.end())
+        return it->second;
+    std::vector<detail::type_info *> bases;
+    all_type_info_populate(type, bases);
+    return bases;
+}
+
 /**
  * Gets a single pybind11 type info for a python type.  Returns nullptr if neither the type nor any
  * ancestors are pybind11-registered.  Throws an exception if there are multiple bases--use
@@ -186,13 +220,48 @@ inline detail::type_info *get_global_type_info(const std::type_index &tp) {
     return nullptr;
 }
 
+/// Returns the deferred binding of a C++ type, if any (see `module_::def_lazy_class`)
+inline const lazy_type *get_lazy_type(const std::type_index &tp) {
+    auto &lazy_types = get_internals().lazy_types;
+    if (lazy_types.empty())
+        return nullptr;
+    auto it = lazy_types.find(tp);
+    return it != lazy_types.end() ? &it->second : nullptr;
+}
+
+/// Binds a C++ type whose binding was deferred by `module_::def_lazy_class`, by accessing the
+/// class in its module (which removes `lazy`). Throws `std::runtime_error` if the binding fails.
+PYBIND11_NOINLINE inline void bind_lazy_type(const lazy_type &lazy) {
+    auto scope = reinterpret_borrow<object>(lazy.scope);
+    auto name = lazy.name;
+    try {
+        getattr(scope, name.c_str());
+    } catch (error_already_set &e) {
+        pybind11_fail("def_lazy_class: could not bind \"" + std::string(str(scope.attr("__name__"))) +
+                      "." + name + "\": " + e.what());
+    }
+}
+
 /// Return the type info for a given C++ type; on lookup failure can either throw or return nullptr.
+/// Types bound lazily (see `module_::def_lazy_class`) are bound first unless `bind_lazy` is false,
+/// which throws if their binding fails.
 PYBIND11_NOINLINE inline detail::type_info *get_type_info(const std::type_index &tp,
-                                                          bool throw_if_missing = false) {
+                                                          bool throw_if_missing = false,
+                                                          bool bind_lazy = true) {
     if (auto ltype = get_local_type_info(tp))
         return ltype;
     if (auto gtype = get_global_type_info(tp))
         return gtype;
+    if (bind_lazy) {
+        if (auto lazy = get_lazy_type(tp)) {
+            // Binding the class removes `lazy` (see `generic_type::initialize`)
+            bind_lazy_type(*lazy);
+            if (auto ltype = get_local_type_info(tp))
+                return ltype;
+            if (auto gtype = get_global_type_info(tp))
+                return gtype;
+        }
+    }
 
     if (throw_if_missing) {
         std::string tname = tp.name();
@@ -202,6 +271,64 @@ PYBIND11_NOINLINE inline detail::type_info *get_type_info(const std::type_index
     return nullptr;
 }
 
+/// Returns the entry of `table` for an exact Python type, computing it with `compute(type)` on
+/// first use. The table is flushed whenever types are registered or destroyed (as the address of
+/// a destroyed type can be reused) and when the internals are replaced. Heap types are only cached
+/// while they are tracked in `registered_types_py`, which flushes the table on their destruction;
+/// for other heap types the entry is computed on every call.
+template <typename Table, typename Compute>
+typename Table::mapped_type type_table_get(Table &table, type_registry_version &version,
+                                           PyTypeObject *type, const Compute &compute) {
+    if (!version.current()) {
+        table.clear();
+        version.update();
+    }
+    auto it = table.find(type);
+    if (it != table.end())
+        return it->second;
+    if (PyType_HasFeature(type, Py_TPFLAGS_HEAPTYPE)
+        && get_internals().registered_types_py.find(type) == get_internals().registered_types_py.end())
+        return compute(type);
+    return table.emplace(type, compute(type)).first->second;
+}
+
+/// Small cache of `get_type_info` results for the dynamic types that are returned through base
+/// pointers of one polymorphic type (see `type_caster_base::src_and_type`). The cache is protected
+/// by the GIL and flushed whenever a type is registered or deregistered (or the internals are
+/// replaced).
+class polymorphic_type_cache {
+public:
+    const detail::type_info *get(const std::type_info &cpptype) {
+        if (version.current())
+            for (auto &entry : entries)
+                if (entry.cpptype == &cpptype)
+                    return entry.tinfo;
+        return lookup(cpptype);
+    }
+
+private:
+    PYBIND11_NOINLINE const detail::type_info *lookup(const std::type_info &cpptype) {
+        if (!version.current()) {
+            for (auto &entry : entries)
+                entry = {};
+            version.update();
+        }
+        auto tinfo = get_type_info(cpptype);
+        entries[next] = {&cpptype, tinfo};
+        next = (next + 1) % size;
+        return tinfo;
+    }
+
+    struct entry {
+        const std::type_info *cpptype;
+        const detail::type_info *tinfo;
+    };
+    static constexpr size_t size = 4;
+    entry entries[size] = {};
+    size_t next = 0;
+    type_registry_version version;
+};
+
 PYBIND11_NOINLINE inline handle get_type_handle(const std::type_info &tp, bool throw_if_missing) {
     detail::type_info *type_info = get_type_info(tp, throw_if_missing);
     return handle(type_info ? ((PyObject *) type_info->type) : nullptr);
@@ -234,6 +361,18 @@ struct value_and_holder {
     template <typename H> H &holder() const {
         return reinterpret_cast<H &>(vh[1]);
     }
+    // Address of the value storage inside the instance for `py::inline_storage()` types (or null)
+    void *inline_storage() const {
+        return type && type->inline_offset ? reinterpret_cast<char *>(inst) + type->inline_offset
+                                           : nullptr;
+    }
+    // True if the value lives inside the instance; there is no holder in that case, and
+    // `holder_constructed()` instead tracks whether the value has been constructed.
+    bool value_is_inline() const {
+        auto *storage = reinterpret_cast<char *>(inline_storage());
+        auto *value = reinterpret_cast<char *>(value_ptr());
+        return storage && value >= storage && value < storage + type->type_size;
+    }
     bool holder_constructed() const {
         return inst->simple_layout
             ? inst->simple_holder_constructed
@@ -516,10 +655,23 @@ public:
             }
         }
 
+        return cast_new_instance(src, policy, parent, tinfo, copy_constructor, move_constructor,
+                                 existing_holder);
+    }
+
+    /// Like `cast()`, but always creates a new instance (i.e. `src` is known not to be
+    /// registered already, and `tinfo` is not null)
+    PYBIND11_NOINLINE static handle cast_new_instance(void *src, return_value_policy policy, handle parent,
+                                                      const detail::type_info *tinfo,
+                                                      void *(*copy_constructor)(const void *),
+                                                      void *(*move_constructor)(const void *),
+                                                      const void *existing_holder = nullptr) {
         auto inst = reinterpret_steal<object>(make_new_instance(tinfo->type));
         auto wrapper = reinterpret_cast<instance *>(inst.ptr());
         wrapper->owned = false;
-        void *&valueptr = values_and_holders(wrapper).begin()->value_ptr();
+        auto v_h = values_and_holders(wrapper).begin();
+        void *&valueptr = v_h->value_ptr();
+        void *storage = v_h->inline_storage();
 
         switch (policy) {
             case return_value_policy::automatic:
@@ -535,7 +687,10 @@ public:
                 break;
 
             case return_value_policy::copy:
-                if (copy_constructor)
+                if (storage && tinfo->inline_copy) {
+                    tinfo->inline_copy(storage, src);
+                    valueptr = storage;
+                } else if (copy_constructor)
                     valueptr = copy_constructor(src);
                 else {
 #if defined(NDEBUG)
@@ -552,7 +707,13 @@ public:
                 break;
 
             case return_value_policy::move:
-                if (move_constructor)
+                if (storage && tinfo->inline_move) {
+                    tinfo->inline_move(storage, src);
+                    valueptr = storage;
+                } else if (storage && tinfo->inline_copy) {
+                    tinfo->inline_copy(storage, src);
+                    valueptr = storage;
+                } else if (move_constructor)
                     valueptr = move_constructor(src);
                 else if (copy_constructor)
                     valueptr = copy_constructor(src);
@@ -592,7 +753,9 @@ public:
         // Lazy allocation for unallocated values:
         if (vptr == nullptr) {
             auto *type = v_h.type ? v_h.type : typeinfo;
-            if (type->operator_new) {
+            if (type->inline_offset) {
+                vptr = reinterpret_cast<char *>(v_h.inst) + type->inline_offset;
+            } else if (type->operator_new) {
                 vptr = type->operator_new(type->type_size);
             } else {
                 #if defined(__cpp_aligned_new) && (!defined(_MSC_VER) || _MSC_VER >= 1912)
@@ -616,6 +779,19 @@ public:
         }
         return false;
     }
+    bool try_cpp_conversions(handle src) {
+        for (auto &conversion : typeinfo->cpp_conversions) {
+            type_caster_generic source(*conversion.first);
+            if (!source.load(src, false) || !source.value)
+                continue;
+            ++typeinfo->implicit_conversion_attempts;
+            value = conversion.second(source.value);
+            loader_life_support::add_temporary(value, typeinfo->cpp_conversion_destroy);
+            ++typeinfo->implicit_conversion_successes;
+            return true;
+        }
+        return false;
+    }
     bool try_direct_conversions(handle src) {
         for (auto &converter : *typeinfo->direct_conversions) {
             if (converter(src.ptr(), value))
@@ -712,13 +888,32 @@ public:
                 return true;
         }
 
-        // Perform an implicit conversion
+        // Perform an implicit conversion, skipping those known not to apply to the source type
         if (convert) {
-            for (auto &converter : typeinfo->implicit_conversions) {
-                auto temp = reinterpret_steal<object>(converter(src.ptr(), typeinfo->type));
-                if (load_impl<ThisT>(temp, false)) {
-                    loader_life_support::add_patient(temp);
-                    return true;
+            if (this_.try_cpp_conversions(src))
+                return true;
+            auto &conversions = typeinfo->implicit_conversions;
+            if (!conversions.empty()) {
+                auto skipped = type_table_get(typeinfo->implicit_conversions_skipped,
+                    typeinfo->implicit_conversions_version, srctype, [this](PyTypeObject *type) {
+                        auto &filters = typeinfo->implicit_conversion_filters;
+                        std::vector<bool> skip(filters.size());
+                        for (size_t i = 0; i < filters.size(); ++i)
+                            skip[i] = !filters[i](type);
+                        return skip;
+                    });
+                for (size_t i = 0; i < conversions.size(); ++i) {
+                    if (i < skipped.size() && skipped[i]) {
+                        ++typeinfo->implicit_conversion_skips;
+                        continue;
+                    }
+                    ++typeinfo->implicit_conversion_attempts;
+                    auto temp = reinterpret_steal<object>(conversions[i](src.ptr(), typeinfo->type));
+                    if (load_impl<ThisT>(temp, false)) {
+                        ++typeinfo->implicit_conversion_successes;
+                        loader_life_support::add_patient(temp);
+                        return true;
+                    }
                 }
             }
             if (this_.try_direct_conversions(src))
@@ -893,7 +1088,8 @@ public:
             // except via a user-provided specialization of polymorphic_type_hook,
             // and the user has promised that no this-pointer adjustment is
             // required in that case, so it's OK to use static_cast.
-            if (const auto *tpi = get_type_info(*instance_type))
+            static polymorphic_type_cache cache;
+            if (const auto *tpi = cache.get(*instance_type))
                 return {vsrc, tpi};
         }
         // Otherwise we have either a nullptr, an `itype` pointer, or an unknown derived pointer, so
@@ -908,6 +1104,14 @@ public:
             make_copy_constructor(src), make_move_constructor(src));
     }
 
+    /// Moves `src` into a new instance of the registered type `tinfo` (the type info of `type`)
+    /// without looking for an existing instance: used for the elements of temporary containers,
+    /// which can't have one.
+    static handle cast_new(itype &&src, handle parent, const detail::type_info *tinfo) {
+        return type_caster_generic::cast_new_instance(&src, return_value_policy::move, parent, tinfo,
+            make_copy_constructor(&src), make_move_constructor(&src));
+    }
+
     static handle cast_holder(const itype *src, const void *holder) {
         auto st = src_and_type(src);
         return type_caster_generic::cast(
@@ -943,9 +1147,20 @@ protected:
     static Constructor make_move_constructor(...) { return nullptr; }
 };
 
-template <typename type, typename SFINAE = void> class type_caster : public type_caster_base<type> { };
+template <typename type, typename SFINAE = void> class type_caster : public type_caster_base<type> {
+public:
+    // Not inherited by custom casters which derive from type_caster_base (see is_generic_caster)
+    using generic_caster = type_caster_base<type>;
+};
 template <typename type> using make_caster = type_caster<intrinsic_t<type>>;
 
+/// Whether `T` (not a pointer or reference) is cast by the generic caster of registered types, i.e.
+/// neither by a custom caster nor by one that derives from `type_caster_base` to override members
+template <typename T, typename SFINAE = void> struct is_generic_caster : std::false_type {};
+template <typename T>
+struct is_generic_caster<T, void_t<typename make_caster<T>::generic_caster>>
+    : std::is_same<typename make_caster<T>::generic_caster, type_caster_base<T>> {};
+
 // Shortcut for calling a caster's `cast_op_type` cast operator for casting a type_caster to a T
 template <typename T> typename make_caster<T>::template cast_op_type<T> cast_op(make_caster<T> &caster) {
     return caster.operator typename make_caster<T>::template cast_op_type<T>();
@@ -1572,6 +1787,7 @@ protected:
         return false;
     }
 
+    static bool try_cpp_conversions(handle) { return false; }
     static bool try_direct_conversions(handle) { return false; }
 
 
@@ -1653,6 +1869,74 @@ struct pyobject_caster {
 template <typename T>
 class type_caster<T, enable_if_t<is_pyobject<T>::value>> : public pyobject_caster<T> { };
 
+/// Conservatively tells whether `make_caster<T>` might load objects of the given exact Python type
+/// without conversions. This is used to skip casters that can't match, e.g. the alternatives of a
+/// variant or implicit conversions; the default (and every specialization in case of doubt)
+/// answers `true`.
+template <typename T, typename SFINAE = void> struct type_load_filter {
+    static constexpr bool informative = false;
+    static bool may_load(PyTypeObject *) { return true; }
+};
+
+template <> struct type_load_filter<bool> {
+    static constexpr bool informative = true;
+    static bool may_load(PyTypeObject *type) {
+        return type == &PyBool_Type || !std::strcmp("numpy.bool_", type->tp_name) ||
+               PyType_HasFeature(type, Py_TPFLAGS_HEAPTYPE);
+    }
+};
+
+template <typename T>
+struct type_load_filter<T, enable_if_t<std::is_arithmetic<T>::value && !std::is_same<T, bool>::value &&
+                                          !is_std_char_type<T>::value>> {
+    static constexpr bool informative = true;
+    static bool may_load(PyTypeObject *type) {
+        if (PyType_IsSubtype(type, &PyFloat_Type))
+            return std::is_floating_point<T>::value;
+        if (std::is_floating_point<T>::value)
+            return false;
+        // The `__index__` of heap types can be added later on, so only static types are known
+        return PyType_IsSubtype(type, &PyLong_Type) || PyType_HasFeature(type, Py_TPFLAGS_HEAPTYPE) ||
+               (type->tp_as_number && type->tp_as_number->nb_index);
+    }
+};
+
+template <typename CharT> struct string_load_filter {
+    static constexpr bool informative = true;
+    static bool may_load(PyTypeObject *type) {
+        return PyType_IsSubtype(type, &PyUnicode_Type) ||
+               (std::is_same<CharT, char>::value && PyType_IsSubtype(type, &PyBytes_Type));
+    }
+};
+
+template <typename CharT, class Traits, class Allocator>
+struct type_load_filter<std::basic_string<CharT, Traits, Allocator>, enable_if_t<is_std_char_type<CharT>::value>>
+    : string_load_filter<CharT> {};
+
+#ifdef PYBIND11_HAS_STRING_VIEW
+template <typename CharT, class Traits>
+struct type_load_filter<std::basic_string_view<CharT, Traits>, enable_if_t<is_std_char_type<CharT>::value>>
+    : string_load_filter<CharT> {};
+#endif
+
+/// Registered types whose caster uses the generic load (i.e. not holders or custom casters)
+template <typename T>
+struct type_load_filter<T, enable_if_t<std::is_same<decltype(&make_caster<T>::load),
+                                                       bool (type_caster_generic::*)(handle, bool)>::value>> {
+    static constexpr bool informative = true;
+    static bool may_load(PyTypeObject *type) {
+        auto tinfo = get_type_info(typeid(T));
+        if (!tinfo || tinfo->module_local || PyType_IsSubtype(type, tinfo->type))
+            return true;
+        // Instances of module-local types of other modules may be loadable as well
+        if (PyType_HasFeature(type, Py_TPFLAGS_HEAPTYPE))
+            for (auto base : all_type_info_lookup(type))
+                if (base->module_local)
+                    return true;
+        return false;
+    }
+};
+
 // Our conditions for enabling moving are quite restrictive:
 // At compile time:
 // - T needs to be a non-const, non-pointer, non-reference type
@@ -1824,13 +2108,10 @@ template <typename T> enable_if_t<cast_is_temporary_value_reference<T>::value, T
     pybind11_fail("Internal error: cast_safe fallback invoked"); }
 template <> inline void cast_safe<void>(object &&) {}
 
-PYBIND11_NAMESPACE_END(detail)
-
-template <return_value_policy policy = return_value_policy::automatic_reference>
-tuple make_tuple() { return tuple(0); }
-
-template <return_value_policy policy = return_value_policy::automatic_reference,
-          typename... Args> tuple make_tuple(Args&&... args_) {
+/// Converts each argument to a Python object, throwing cast_error if any of them fail.
+/// Shared by make_tuple() and the call argument collectors.
+template <return_value_policy policy, typename... Args>
+std::array<object, sizeof...(Args)> cast_args(Args&&... args_) {
     constexpr size_t size = sizeof...(Args);
     std::array<object, size> args {
         { reinterpret_steal<object>(detail::make_caster<Args>::cast(
@@ -1847,7 +2128,18 @@ template <return_value_policy policy = return_value_policy::automatic_reference,
 #endif
         }
     }
-    tuple result(size);
+    return args;
+}
+
+PYBIND11_NAMESPACE_END(detail)
+
+template <return_value_policy policy = return_value_policy::automatic_reference>
+tuple make_tuple() { return tuple(0); }
+
+template <return_value_policy policy = return_value_policy::automatic_reference,
+          typename... Args> tuple make_tuple(Args&&... args_) {
+    auto args = detail::cast_args<policy>(std::forward<Args>(args_)...);
+    tuple result(args.size());
     int counter = 0;
     for (auto &arg_value : args)
         PyTuple_SET_ITEM(result.ptr(), counter++, arg_value.release().ptr());
@@ -1973,6 +2265,35 @@ struct function_call {
     handle init_self;
 };
 
+template <typename T> struct holds_python_object;
+
+/// Detects Python objects nested in the template arguments of `T` (e.g. `std::vector<object>`)
+template <typename T> struct template_args_hold_python_object : std::false_type { };
+template <template <typename...> class Tmpl, typename... Ts>
+struct template_args_hold_python_object<Tmpl<Ts...>> : any_of<holds_python_object<intrinsic_t<Ts>>...> { };
+template <typename T, size_t N>
+struct template_args_hold_python_object<std::array<T, N>> : holds_python_object<intrinsic_t<T>> { };
+// A std::function may wrap a Python callable (see functional.h)
+template <typename Return, typename... Args>
+struct template_args_hold_python_object<std::function<Return(Args...)>> : std::true_type { };
+
+/// Whether an (intrinsic) argument or return type `T` refers to Python objects, in which case
+/// values of it can't be used or destroyed while the GIL is released.
+template <typename T> struct holds_python_object
+    : any_of<is_pyobject<T>, template_args_hold_python_object<T>> { };
+
+/// Releases the GIL for the lifetime of the object if `release` is true
+class optional_gil_release {
+public:
+    explicit optional_gil_release(bool release) : tstate(release ? PyEval_SaveThread() : nullptr) { }
+    optional_gil_release(const optional_gil_release &) = delete;
+    ~optional_gil_release() {
+        if (tstate)
+            PyEval_RestoreThread(tstate);
+    }
+private:
+    PyThreadState *tstate;
+};
 
 /// Helper class which loads arguments for C++ functions called from Python
 template <typename... Args>
@@ -1993,6 +2314,10 @@ public:
     static constexpr bool has_kwargs = kwargs_pos < 0;
     static constexpr bool has_args = args_pos < 0;
 
+    /// True if none of the arguments refer to Python objects, i.e. the function body can
+    /// safely run with the GIL released once the arguments have been loaded.
+    static constexpr bool gil_independent = !any_of<holds_python_object<intrinsic_t<Args>>...>::value;
+
     static constexpr auto arg_names = concat(type_descr(make_caster<Args>::name)...);
 
     bool load_args(function_call &call) {
@@ -2010,6 +2335,14 @@ public:
         return void_type();
     }
 
+    /// Like `call()`, but optionally releases the GIL around the function call. The GIL is
+    /// re-acquired before the return value is handed back to be cast to Python.
+    template <typename Return, typename Guard, typename Func>
+    conditional_t<std::is_void<Return>::value, void_type, Return> call(Func &&f, bool release_gil) && {
+        optional_gil_release nogil(gil_independent && release_gil);
+        return std::move(*this).template call<Return, Guard>(std::forward<Func>(f));
+    }
+
 private:
 
     static bool load_impl_sequence(function_call &, index_sequence<>) { return true; }
@@ -2036,29 +2369,44 @@ private:
 };
 
 /// Helper class which collects only positional arguments for a Python function call.
-/// A fancier version below can collect any argument, but this one is optimal for simple calls.
-template <return_value_policy policy>
+/// A fancier version below can collect any argument, but this one is optimal for simple calls:
+/// where the vectorcall protocol is available, the converted arguments are passed straight
+/// from a stack array and no argument tuple is allocated.
+template <return_value_policy policy, size_t N>
 class simple_collector {
 public:
     template <typename... Ts>
     explicit simple_collector(Ts &&...values)
-        : m_args(pybind11::make_tuple<policy>(std::forward<Ts>(values)...)) { }
+        : m_args(cast_args<policy>(std::forward<Ts>(values)...)) { }
 
-    const tuple &args() const & { return m_args; }
+    tuple args() const {
+        tuple result(N);
+        for (size_t i = 0; i < N; i++)
+            PyTuple_SET_ITEM(result.ptr(), (ssize_t) i, m_args[i].inc_ref().ptr());
+        return result;
+    }
     dict kwargs() const { return {}; }
 
-    tuple args() && { return std::move(m_args); }
-
     /// Call a Python function and pass the collected arguments
     object call(PyObject *ptr) const {
-        PyObject *result = PyObject_CallObject(ptr, m_args.ptr());
+#if defined(PYBIND11_HAS_VECTORCALL)
+        // Slot 0 is scratch space which the callee may use to prepend `self` (e.g. for bound
+        // methods) without having to copy the argument array.
+        PyObject *stack[N + 1];
+        stack[0] = nullptr;
+        for (size_t i = 0; i < N; i++)
+            stack[i + 1] = m_args[i].ptr();
+        PyObject *result = PYBIND11_VECTORCALL(ptr, stack + 1, N | PY_VECTORCALL_ARGUMENTS_OFFSET, nullptr);
+#else
+        PyObject *result = PyObject_CallObject(ptr, args().ptr());
+#endif
         if (!result)
             throw error_already_set();
         return reinterpret_steal<object>(result);
     }
 
 private:
-    tuple m_args;
+    std::array<object, N> m_args;
 };
 
 /// Helper class which collects positional, keyword, * and ** arguments for a Python function call
@@ -2195,8 +2543,8 @@ constexpr bool args_are_all_positional()
 /// Collect only positional arguments for a Python function call
 template <return_value_policy policy, typename... Args,
           typename = enable_if_t<args_are_all_positional<Args...>()>>
-simple_collector<policy> collect_arguments(Args &&...args) {
-    return simple_collector<policy>(std::forward<Args>(args)...);
+simple_collector<policy, sizeof...(Args)> collect_arguments(Args &&...args) {
+    return simple_collector<policy, sizeof...(Args)>(std::forward<Args>(args)...);
 }
 
 /// Collect all arguments, including keywords and unpacking (only instantiated when needed)
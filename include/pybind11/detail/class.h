@@ -215,6 +215,7 @@ extern "C" inline void pybind11_meta_dealloc(PyObject *obj) {
         else
             internals.registered_types_cpp.erase(tindex);
         internals.registered_types_py.erase(tinfo->type);
+        ++internals.type_registry_generation;
 
         // Actually just `std::erase_if`, but that's only available in C++20
         auto &cache = internals.inactive_override_cache;
@@ -323,6 +324,47 @@ inline bool deregister_instance(instance *self, void *valptr, const type_info *t
     return ret;
 }
 
+/// py::free_list: returns the free list of instances of exactly the given type, if any
+inline instance_free_list *get_free_list(PyTypeObject *type) {
+    auto &tinfo = all_type_info(type);
+    return tinfo.size() == 1 && tinfo[0]->type == type ? tinfo[0]->free_list : nullptr;
+}
+
+/// py::free_list: `tp_alloc` that reuses the memory of destroyed instances
+extern "C" inline PyObject *pybind11_free_list_alloc(PyTypeObject *type, ssize_t nitems) {
+    auto free_list = get_free_list(type);
+    if (!free_list || free_list->blocks.empty()) {
+        if (free_list)
+            ++free_list->allocated;
+        return PyType_GenericAlloc(type, nitems);
+    }
+    auto self = static_cast<PyObject *>(free_list->blocks.back());
+    free_list->blocks.pop_back();
+    ++free_list->reused;
+    // Same initialization as PyType_GenericAlloc (which only increfs heap types itself before 3.8)
+    std::memset(self, 0, static_cast<size_t>(type->tp_basicsize));
+#if PY_VERSION_HEX < 0x03080000
+    Py_INCREF(type);
+#endif
+    return PyObject_Init(self, type);
+}
+
+/// py::free_list: `tp_free` that keeps the memory of destroyed instances (up to the maximum size)
+extern "C" inline void pybind11_free_list_free(void *self) {
+    auto free_list = get_free_list(Py_TYPE(reinterpret_cast<PyObject *>(self)));
+    if (free_list && free_list->blocks.size() < free_list->max_size)
+        free_list->blocks.push_back(self);
+    else
+        PyObject_Del(self);
+}
+
+/// py::free_list: releases the memory kept by a free list
+inline void clear_free_list(instance_free_list *free_list) {
+    for (auto block : free_list->blocks)
+        PyObject_Del(block);
+    free_list->blocks.clear();
+}
+
 /// Instance creation function for all pybind11 types. It allocates the internal instance layout for
 /// holding C++ objects and holders.  Allocation is done lazily (the first time the instance is cast
 /// to a reference or pointer), and initialization is done by an `__init__` function.
@@ -360,26 +402,42 @@ extern "C" inline int pybind11_object_init(PyObject *self, PyObject *, PyObject
 }
 
 inline void add_patient(PyObject *nurse, PyObject *patient) {
-    auto &internals = get_internals();
     auto instance = reinterpret_cast<detail::instance *>(nurse);
-    instance->has_patients = true;
     Py_INCREF(patient);
-    internals.patients[nurse].push_back(patient);
+    if (!instance->has_patients) {
+        instance->patient = patient;
+        instance->has_patients = true;
+    } else if (!instance->has_patient_list) {
+        instance->patient_list = new std::vector<PyObject *>{instance->patient, patient};
+        instance->has_patient_list = true;
+    } else {
+        instance->patient_list->push_back(patient);
+    }
 }
 
 inline void clear_patients(PyObject *self) {
     auto instance = reinterpret_cast<detail::instance *>(self);
-    auto &internals = get_internals();
-    auto pos = internals.patients.find(self);
-    assert(pos != internals.patients.end());
     // Clearing the patients can cause more Python code to run, which
-    // can invalidate the iterator. Extract the vector of patients
-    // from the unordered_map first.
-    auto patients = std::move(pos->second);
-    internals.patients.erase(pos);
-    instance->has_patients = false;
-    for (PyObject *&patient : patients)
+    // can add new patients to this instance. Detach the current
+    // patients from the instance first.
+    if (instance->has_patient_list) {
+        std::unique_ptr<std::vector<PyObject *>> patients(instance->patient_list);
+        instance->has_patients = false;
+        instance->has_patient_list = false;
+        for (PyObject *&patient : *patients)
+            Py_CLEAR(patient);
+    } else {
+        PyObject *patient = instance->patient;
+        instance->has_patients = false;
         Py_CLEAR(patient);
+    }
+}
+
+/// Returns the weak reference list slot of an instance (null if its type has none)
+inline PyObject **instance_weakrefs(PyObject *self) {
+    auto offset = Py_TYPE(self)->tp_weaklistoffset;
+    return offset > 0 ? reinterpret_cast<PyObject **>(reinterpret_cast<char *>(self) + offset)
+                      : nullptr;
 }
 
 /// Clears all internal data from the instance and removes it from registered instances in
@@ -403,8 +461,9 @@ inline void clear_instance(PyObject *self) {
     // Deallocate the value/holder layout internals:
     instance->deallocate_layout();
 
-    if (instance->weakrefs)
-        PyObject_ClearWeakRefs(self);
+    if (auto weakrefs = instance_weakrefs(self))
+        if (*weakrefs)
+            PyObject_ClearWeakRefs(self);
 
     PyObject **dict_ptr = _PyObject_GetDictPtr(self);
     if (dict_ptr)
@@ -439,9 +498,10 @@ extern "C" inline void pybind11_object_dealloc(PyObject *self) {
 
 /** Create the type which can be used as a common base for all classes.  This is
     needed in order to satisfy Python's requirements for multiple inheritance.
+    Instances of the base type support weak references unless `weakrefs` is false.
     Return value: New reference. */
-inline PyObject *make_object_base_type(PyTypeObject *metaclass) {
-    constexpr auto *name = "pybind11_object";
+inline PyObject *make_object_base_type(PyTypeObject *metaclass, bool weakrefs) {
+    auto *name = weakrefs ? "pybind11_object" : "pybind11_compact_object";
     auto name_obj = reinterpret_steal<object>(PYBIND11_FROM_STRING(name));
 
     /* Danger zone: from now (and until PyType_Ready), make sure to
@@ -468,7 +528,10 @@ inline PyObject *make_object_base_type(PyTypeObject *metaclass) {
     type->tp_dealloc = pybind11_object_dealloc;
 
     /* Support weak references (needed for the keep_alive feature) */
-    type->tp_weaklistoffset = offsetof(instance, weakrefs);
+    if (weakrefs) {
+        type->tp_weaklistoffset = type->tp_basicsize;
+        type->tp_basicsize += static_cast<ssize_t>(sizeof(PyObject *));
+    }
 
     if (PyType_Ready(type) < 0)
         pybind11_fail("PyType_Ready failed in make_object_base_type():" + error_string());
@@ -592,6 +655,42 @@ inline void enable_buffer_protocol(PyHeapTypeObject *heap_type) {
     heap_type->as_buffer.bf_releasebuffer = pybind11_releasebuffer;
 }
 
+/// Returns the common base of types without pybind11 bases: `pybind11_object`, or the compact
+/// `pybind11_compact_object` (which lacks the weak reference list) for py::no_weakref() types
+inline PyObject *instance_base_of(const type_record &rec) {
+    auto &internals = get_internals();
+    if (!rec.no_weakref)
+        return internals.instance_base;
+    if (!internals.compact_instance_base)
+        internals.compact_instance_base = make_object_base_type(internals.default_metaclass, false);
+    return internals.compact_instance_base;
+}
+
+/// Returns the part of the instance layout used by the base types of a record: the `instance`
+/// header and weak reference list followed by the inline values of any `py::inline_storage()`
+/// bases (but not `__dict__`)
+inline size_t instance_size_of_bases(const type_record &rec) {
+    if (rec.bases.empty())
+        return static_cast<size_t>(((PyTypeObject *) instance_base_of(rec))->tp_basicsize);
+    size_t size = 0;
+    for (auto &base : rec.bases) {
+        auto type = (PyTypeObject *) base.ptr();
+        auto used = static_cast<size_t>(type->tp_dictoffset > 0 ? type->tp_dictoffset
+                                                                 : type->tp_basicsize);
+        if (used > size)
+            size = used;
+    }
+    return size;
+}
+
+/// py::inline_storage: offset of the C++ value inside instances of the type (0 if not inline)
+inline size_t inline_storage_offset(const type_record &rec) {
+    if (!rec.inline_storage)
+        return 0;
+    auto size = instance_size_of_bases(rec);
+    return (size + rec.type_align - 1) / rec.type_align * rec.type_align;
+}
+
 /** Create a brand new Python type according to the `type_record` specification.
     Return value: New reference. */
 inline PyObject* make_new_python_type(const type_record &rec) {
@@ -630,9 +729,12 @@ inline PyObject* make_new_python_type(const type_record &rec) {
         memcpy((void *) tp_doc, rec.doc, size);
     }
 
+    auto basicsize = rec.inline_storage ? inline_storage_offset(rec) + rec.type_size
+                                        : instance_size_of_bases(rec);
+
     auto &internals = get_internals();
     auto bases = tuple(rec.bases);
-    auto base = (bases.empty()) ? internals.instance_base
+    auto base = (bases.empty()) ? instance_base_of(rec)
                                     : bases[0].ptr();
 
     /* Danger zone: from now (and until PyType_Ready), make sure to
@@ -655,7 +757,7 @@ inline PyObject* make_new_python_type(const type_record &rec) {
     type->tp_name = full_name;
     type->tp_doc = tp_doc;
     type->tp_base = type_incref((PyTypeObject *)base);
-    type->tp_basicsize = static_cast<ssize_t>(sizeof(instance));
+    type->tp_basicsize = static_cast<ssize_t>(basicsize);
     if (!bases.empty())
         type->tp_bases = bases.release().ptr();
 
@@ -678,6 +780,16 @@ inline PyObject* make_new_python_type(const type_record &rec) {
     if (!rec.is_final)
         type->tp_flags |= Py_TPFLAGS_BASETYPE;
 
+    /* Instance memory (set explicitly, so that subclasses don't inherit a free list) */
+    type->tp_alloc = PyType_GenericAlloc;
+    type->tp_free = rec.dynamic_attr ? PyObject_GC_Del : PyObject_Del;
+#if !defined(PYPY_VERSION)
+    if (rec.free_list_size) {
+        type->tp_alloc = pybind11_free_list_alloc;
+        type->tp_free = pybind11_free_list_free;
+    }
+#endif
+
     if (rec.dynamic_attr)
         enable_dynamic_attributes(heap_type);
 
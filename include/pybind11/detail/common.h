@@ -231,6 +231,16 @@ extern "C" {
 }
 #endif
 
+// The vectorcall protocol (PEP 590) lets C++ call Python callables without packing the
+// arguments into a temporary tuple. It is provisional (underscore-prefixed) in CPython 3.8.
+#if !defined(PYPY_VERSION) && PY_VERSION_HEX >= 0x03090000
+#  define PYBIND11_HAS_VECTORCALL
+#  define PYBIND11_VECTORCALL PyObject_Vectorcall
+#elif !defined(PYPY_VERSION) && PY_VERSION_HEX >= 0x03080000
+#  define PYBIND11_HAS_VECTORCALL
+#  define PYBIND11_VECTORCALL _PyObject_Vectorcall
+#endif
+
 #define PYBIND11_TRY_NEXT_OVERLOAD ((PyObject *) 1) // special failure return code
 #define PYBIND11_STRINGIFY(x) #x
 #define PYBIND11_TOSTRING(x) PYBIND11_STRINGIFY(x)
@@ -319,6 +329,9 @@ extern "C" {
     PYBIND11_PLUGIN_IMPL(name) {                                               \
         PYBIND11_CHECK_PYTHON_VERSION                                          \
         PYBIND11_ENSURE_INTERNALS_READY                                        \
+        ::pybind11::detail::import_profile_module pybind11_import_profile(     \
+            PYBIND11_TOSTRING(name));                                          \
+        ::pybind11::detail::deferred_docstrings pybind11_docstrings;           \
         auto m = ::pybind11::module_::create_extension_module(                 \
             PYBIND11_TOSTRING(name), nullptr,                                  \
             &PYBIND11_CONCAT(pybind11_module_def_, name));                     \
@@ -423,8 +436,12 @@ struct instance {
         void *simple_value_holder[1 + instance_simple_holder_in_ptrs()];
         nonsimple_values_and_holders nonsimple;
     };
-    /// Weak references
-    PyObject *weakrefs;
+    /// keep_alive patients (see `has_patients`): a single patient is stored directly, several
+    /// patients in a separately allocated list
+    union {
+        PyObject *patient;
+        std::vector<PyObject *> *patient_list;
+    };
     /// If true, the pointer is owned which means we're free to manage it with a holder.
     bool owned : 1;
     /**
@@ -455,8 +472,10 @@ struct instance {
     bool simple_holder_constructed : 1;
     /// For simple layout, tracks whether the instance is registered in `registered_instances`
     bool simple_instance_registered : 1;
-    /// If true, get_internals().patients has an entry for this object
+    /// If true, `patient` or `patient_list` holds references to keep_alive patients
     bool has_patients : 1;
+    /// If true, the patients are stored in `patient_list`
+    bool has_patient_list : 1;
 
     /// Initializes all of the above type/values/holders data (but not the instance values themselves)
     void allocate_layout();
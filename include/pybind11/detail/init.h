@@ -57,10 +57,19 @@ constexpr bool is_alias(void *) { return false; }
 // py::init, e.g.  `py::init<int, int>` to initialize a `struct T { int a; int b; }`.  For
 // non-aggregate types, we need to use an ordinary T(...) constructor (invoking as `T{...}` usually
 // works, but will not do the expected thing when `T` has an `initializer_list<T>` constructor).
+// Types bound with py::inline_storage() are constructed in place inside the instance.
 template <typename Class, typename... Args, detail::enable_if_t<std::is_constructible<Class, Args...>::value, int> = 0>
-inline Class *construct_or_initialize(Args &&...args) { return new Class(std::forward<Args>(args)...); }
+inline Class *construct_or_initialize(value_and_holder &v_h, Args &&...args) {
+    if (void *storage = v_h.inline_storage())
+        return ::new (storage) Class(std::forward<Args>(args)...);
+    return new Class(std::forward<Args>(args)...);
+}
 template <typename Class, typename... Args, detail::enable_if_t<!std::is_constructible<Class, Args...>::value, int> = 0>
-inline Class *construct_or_initialize(Args &&...args) { return new Class{std::forward<Args>(args)...}; }
+inline Class *construct_or_initialize(value_and_holder &v_h, Args &&...args) {
+    if (void *storage = v_h.inline_storage())
+        return ::new (storage) Class{std::forward<Args>(args)...};
+    return new Class{std::forward<Args>(args)...};
+}
 
 // Attempts to constructs an alias using a `Alias(Cpp &&)` constructor.  This allows types with
 // an alias to provide only a single Cpp factory function as long as the Alias can be
@@ -70,7 +79,7 @@ inline Class *construct_or_initialize(Args &&...args) { return new Class{std::fo
 template <typename Class>
 void construct_alias_from_cpp(std::true_type /*is_alias_constructible*/,
                               value_and_holder &v_h, Cpp<Class> &&base) {
-    v_h.value_ptr() = new Alias<Class>(std::move(base));
+    v_h.value_ptr() = construct_or_initialize<Alias<Class>>(v_h, std::move(base));
 }
 template <typename Class>
 [[noreturn]] void construct_alias_from_cpp(std::false_type /*!is_alias_constructible*/,
@@ -153,7 +162,7 @@ void construct(value_and_holder &v_h, Cpp<Class> &&result, bool need_alias) {
     if (Class::has_alias && need_alias)
         construct_alias_from_cpp<Class>(is_alias_constructible<Class>{}, v_h, std::move(result));
     else
-        v_h.value_ptr() = new Cpp<Class>(std::move(result));
+        v_h.value_ptr() = construct_or_initialize<Cpp<Class>>(v_h, std::move(result));
 }
 
 // return-by-value version 2: returning a value of the alias type itself.  We move-construct an
@@ -163,7 +172,7 @@ template <typename Class>
 void construct(value_and_holder &v_h, Alias<Class> &&result, bool) {
     static_assert(std::is_move_constructible<Alias<Class>>::value,
         "pybind11::init() return-by-alias-value factory function requires a movable alias class");
-    v_h.value_ptr() = new Alias<Class>(std::move(result));
+    v_h.value_ptr() = construct_or_initialize<Alias<Class>>(v_h, std::move(result));
 }
 
 // Implementing class for py::init<...>()
@@ -172,7 +181,7 @@ struct constructor {
     template <typename Class, typename... Extra, enable_if_t<!Class::has_alias, int> = 0>
     static void execute(Class &cl, const Extra&... extra) {
         cl.def("__init__", [](value_and_holder &v_h, Args... args) {
-            v_h.value_ptr() = construct_or_initialize<Cpp<Class>>(std::forward<Args>(args)...);
+            v_h.value_ptr() = construct_or_initialize<Cpp<Class>>(v_h, std::forward<Args>(args)...);
         }, is_new_style_constructor(), extra...);
     }
 
@@ -182,9 +191,9 @@ struct constructor {
     static void execute(Class &cl, const Extra&... extra) {
         cl.def("__init__", [](value_and_holder &v_h, Args... args) {
             if (Py_TYPE(v_h.inst) == v_h.type->type)
-                v_h.value_ptr() = construct_or_initialize<Cpp<Class>>(std::forward<Args>(args)...);
+                v_h.value_ptr() = construct_or_initialize<Cpp<Class>>(v_h, std::forward<Args>(args)...);
             else
-                v_h.value_ptr() = construct_or_initialize<Alias<Class>>(std::forward<Args>(args)...);
+                v_h.value_ptr() = construct_or_initialize<Alias<Class>>(v_h, std::forward<Args>(args)...);
         }, is_new_style_constructor(), extra...);
     }
 
@@ -193,7 +202,7 @@ struct constructor {
                           !std::is_constructible<Cpp<Class>, Args...>::value, int> = 0>
     static void execute(Class &cl, const Extra&... extra) {
         cl.def("__init__", [](value_and_holder &v_h, Args... args) {
-            v_h.value_ptr() = construct_or_initialize<Alias<Class>>(std::forward<Args>(args)...);
+            v_h.value_ptr() = construct_or_initialize<Alias<Class>>(v_h, std::forward<Args>(args)...);
         }, is_new_style_constructor(), extra...);
     }
 };
@@ -204,7 +213,7 @@ template <typename... Args> struct alias_constructor {
               enable_if_t<Class::has_alias && std::is_constructible<Alias<Class>, Args...>::value, int> = 0>
     static void execute(Class &cl, const Extra&... extra) {
         cl.def("__init__", [](value_and_holder &v_h, Args... args) {
-            v_h.value_ptr() = construct_or_initialize<Alias<Class>>(std::forward<Args>(args)...);
+            v_h.value_ptr() = construct_or_initialize<Alias<Class>>(v_h, std::forward<Args>(args)...);
         }, is_new_style_constructor(), extra...);
     }
 };
@@ -296,6 +305,21 @@ void setstate(value_and_holder &v_h, std::pair<T, O> &&result, bool need_alias)
     setattr((PyObject *) v_h.inst, "__dict__", result.second);
 }
 
+/// Defines the `__setstate__` of py::pickle(GetState, SetState)
+template <typename Class, typename ArgState, typename Set, typename... Extra>
+void def_setstate(Class &cl, Set &&set, const Extra &...extra) {
+#if defined(PYBIND11_CPP14)
+    cl.def("__setstate__", [func = std::forward<Set>(set)]
+#else
+    auto func = std::forward<Set>(set);
+    cl.def("__setstate__", [func]
+#endif
+    (value_and_holder &v_h, ArgState state) {
+        setstate<Class>(v_h, func(std::forward<ArgState>(state)),
+                        Py_TYPE(v_h.inst) != v_h.type->type);
+    }, is_new_style_constructor(), extra...);
+}
+
 /// Implementation for py::pickle(GetState, SetState)
 template <typename Get, typename Set,
           typename = function_signature_t<Get>, typename = function_signature_t<Set>>
@@ -317,17 +341,48 @@ struct pickle_factory<Get, Set, RetState(Self), NewInstance(ArgState)> {
     template <typename Class, typename... Extra>
     void execute(Class &cl, const Extra &...extra) && {
         cl.def("__getstate__", std::move(get));
+        def_setstate<Class, ArgState>(cl, std::move(set), extra...);
+    }
+};
+
+/// Implementation for py::pickle(GetState, SetState) when `GetState` also takes the pickle
+/// protocol: defines `__reduce_ex__` instead of `__getstate__`
+template <typename Get, typename Set, typename RetState, typename Self, typename Protocol,
+          typename NewInstance, typename ArgState>
+struct pickle_factory<Get, Set, RetState(Self, Protocol), NewInstance(ArgState)> {
+    static_assert(std::is_same<intrinsic_t<RetState>, intrinsic_t<ArgState>>::value,
+                  "The type returned by `__getstate__` must be the same "
+                  "as the argument accepted by `__setstate__`");
+    static_assert(std::is_integral<intrinsic_t<Protocol>>::value,
+                  "The second argument of `__getstate__` must be the pickle protocol");
+
+    remove_reference_t<Get> get;
+    remove_reference_t<Set> set;
+
+    pickle_factory(Get get, Set set)
+        : get(std::forward<Get>(get)), set(std::forward<Set>(set)) { }
 
+    template <typename Class, typename... Extra>
+    void execute(Class &cl, const Extra &...extra) && {
 #if defined(PYBIND11_CPP14)
-        cl.def("__setstate__", [func = std::move(set)]
+        cl.def("__reduce_ex__", [func = std::move(get)]
 #else
-        auto &func = set;
-        cl.def("__setstate__", [func]
+        auto &func = get;
+        cl.def("__reduce_ex__", [func]
 #endif
-        (value_and_holder &v_h, ArgState state) {
-            setstate<Class>(v_h, func(std::forward<ArgState>(state)),
-                            Py_TYPE(v_h.inst) != v_h.type->type);
-        }, is_new_style_constructor(), extra...);
+        (handle self, Protocol protocol) {
+            // What `object.__reduce_ex__` returns for protocol 2+ (and `__setstate__`)
+#if PY_MAJOR_VERSION >= 3
+            auto copyreg = reinterpret_steal<object>(PyImport_ImportModule("copyreg"));
+#else
+            auto copyreg = reinterpret_steal<object>(PyImport_ImportModule("copy_reg"));
+#endif
+            if (!copyreg)
+                throw error_already_set();
+            return make_tuple(copyreg.attr("__newobj__"), make_tuple(type::handle_of(self)),
+                              func(self.cast<Self>(), protocol));
+        });
+        def_setstate<Class, ArgState>(cl, std::move(set), extra...);
     }
 };
 
@@ -10,13 +10,14 @@
 #pragma once
 
 #include "../pytypes.h"
+#include <chrono>
 
 PYBIND11_NAMESPACE_BEGIN(PYBIND11_NAMESPACE)
 PYBIND11_NAMESPACE_BEGIN(detail)
 // Forward declarations
 inline PyTypeObject *make_static_property_type();
 inline PyTypeObject *make_default_metaclass();
-inline PyObject *make_object_base_type(PyTypeObject *metaclass);
+inline PyObject *make_object_base_type(PyTypeObject *metaclass, bool weakrefs = true);
 
 // The old Python Thread Local Storage (TLS) API is deprecated in Python 3.7 in favor of the new
 // Thread Specific Storage (TSS) API.
@@ -90,23 +91,47 @@ struct override_hash {
     }
 };
 
+/// A C++ value created by an implicit conversion and owned by the `loader_life_support` frame
+/// with the given depth
+struct loader_temporary {
+    size_t frame;
+    void *value;
+    void (*destroy)(void *);
+};
+
+/// A class whose binding is deferred until its first use (see `module_::def_lazy_class`)
+struct lazy_type {
+    PyObject *scope; // The module defining the class (see `lazy_binding`)
+    std::string name;
+};
+
 /// Internal data structure used to track registered instances and types.
 /// Whenever binary incompatible changes are made to this structure,
 /// `PYBIND11_INTERNALS_VERSION` must be incremented.
 struct internals {
     type_map<type_info *> registered_types_cpp; // std::type_index -> pybind11's type information
+    // Tells these internals apart from those of an embedded interpreter that was finalized before
+    // (a clock reading, as the new internals may be allocated at the same address)
+    size_t id = (size_t) std::chrono::steady_clock::now().time_since_epoch().count();
+    // Incremented whenever types are (de)registered. It starts from `id`, so that generations seen
+    // with earlier internals aren't repeated (see `type_registry_version`).
+    size_t type_registry_generation = id;
     std::unordered_map<PyTypeObject *, std::vector<type_info *>> registered_types_py; // PyTypeObject* -> base type_info(s)
     std::unordered_multimap<const void *, instance*> registered_instances; // void * -> instance*
     std::unordered_set<std::pair<const PyObject *, const char *>, override_hash> inactive_override_cache;
     type_map<std::vector<bool (*)(PyObject *, void *&)>> direct_conversions;
-    std::unordered_map<const PyObject *, std::vector<PyObject *>> patients;
+    type_map<lazy_type> lazy_types; // Classes not bound yet (see `module_::def_lazy_class`)
     std::forward_list<void (*) (std::exception_ptr)> registered_exception_translators;
     std::unordered_map<std::string, void *> shared_data; // Custom data to be shared across extensions
     std::vector<PyObject *> loader_patient_stack; // Used by `loader_life_support`
+    std::vector<loader_temporary> loader_temporaries; // Used by `loader_life_support`
     std::forward_list<std::string> static_strings; // Stores the std::strings backing detail::c_str()
     PyTypeObject *static_property_type;
+    PyTypeObject *member_descriptor_type = nullptr; // created on first use
     PyTypeObject *default_metaclass;
     PyObject *instance_base;
+    PyObject *compact_instance_base = nullptr; // created on first use
+    PyObject *import_profile = nullptr; // Records of the module initialization being profiled, if any
 #if defined(WITH_THREAD)
     PYBIND11_TLS_KEY_INIT(tstate);
     PyInterpreterState *istate = nullptr;
@@ -123,6 +148,29 @@ struct internals {
 #endif
 };
 
+/// Memory of destroyed instances kept for reuse by a type bound with py::free_list()
+struct instance_free_list {
+    std::vector<void *> blocks;
+    size_t max_size = 0;
+    size_t reused = 0;    // instances allocated from `blocks`
+    size_t allocated = 0; // instances allocated through `tp_alloc`
+};
+
+/// The state of the type registry that a cache of type lookups was filled in. Caches must be
+/// flushed when types are registered or destroyed, and when the internals are replaced (i.e. after
+/// `finalize_interpreter()`); the cache objects themselves are usually static.
+class type_registry_version {
+public:
+    /// Whether the registry is still in the recorded state
+    bool current() const;
+    /// Records the current state of the registry
+    void update();
+
+private:
+    const internals *owner = nullptr;
+    size_t generation = 0;
+};
+
 /// Additional type information which does not fit into the PyTypeObject.
 /// Changes to this struct also require bumping `PYBIND11_INTERNALS_VERSION`.
 struct type_info {
@@ -133,11 +181,31 @@ struct type_info {
     void (*init_instance)(instance *, const void *);
     void (*dealloc)(value_and_holder &v_h);
     std::vector<PyObject *(*)(PyObject *, PyTypeObject *)> implicit_conversions;
+    /* implicitly_convertible: per conversion, conservatively tells whether it might apply to
+       objects of an exact source type (see type_load_filter) */
+    std::vector<bool (*)(PyTypeObject *)> implicit_conversion_filters;
+    /* implicitly_convertible(py::cpp_conversion()): source type -> function constructing a new
+       value from a source value, and the function destroying such values */
+    std::vector<std::pair<const std::type_info *, void *(*)(const void *)>> cpp_conversions;
+    void (*cpp_conversion_destroy)(void *) = nullptr;
+    /* Negative cache: source type -> conversions which can't apply to it */
+    mutable std::unordered_map<PyTypeObject *, std::vector<bool>> implicit_conversions_skipped;
+    mutable type_registry_version implicit_conversions_version;
+    /* Counters of attempted, successful and skipped implicit conversions */
+    mutable size_t implicit_conversion_attempts = 0, implicit_conversion_successes = 0,
+                   implicit_conversion_skips = 0;
     std::vector<std::pair<const std::type_info *, void *(*)(void *)>> implicit_casts;
     std::vector<bool (*)(PyObject *, void *&)> *direct_conversions;
     buffer_info *(*get_buffer)(PyObject *, void *) = nullptr;
     void *get_buffer_data = nullptr;
     void *(*module_local_load)(PyObject *, const type_info *) = nullptr;
+    /* py::inline_storage: offset of the value storage inside the instance (0 if not used) and
+       functions to copy/move construct a value into it (null if not copyable/movable) */
+    size_t inline_offset = 0;
+    void (*inline_copy)(void *, const void *) = nullptr;
+    void (*inline_move)(void *, void *) = nullptr;
+    /* py::free_list: recycled instance memory (null if not used) */
+    instance_free_list *free_list = nullptr;
     /* A simple type never occurs as a (direct or indirect) parent
      * of a class that makes use of multiple inheritance */
     bool simple_type : 1;
@@ -150,7 +218,7 @@ struct type_info {
 };
 
 /// Tracks the `internals` and `type_info` ABI version independent of the main library version
-#define PYBIND11_INTERNALS_VERSION 4
+#define PYBIND11_INTERNALS_VERSION 5
 
 /// On MSVC, debug and release builds are not ABI-compatible!
 #if defined(_MSC_VER) && defined(_DEBUG)
@@ -311,6 +379,24 @@ PYBIND11_NOINLINE inline internals &get_internals() {
     return **internals_pp;
 }
 
+/// The `id` of the current internals, or 0 if they don't exist (yet). Doesn't create them, as that
+/// uses `interned_str`, which calls this.
+inline size_t internals_id() {
+    auto **internals_pp = get_internals_pp();
+    return internals_pp && *internals_pp ? (*internals_pp)->id : 0;
+}
+
+inline bool type_registry_version::current() const {
+    auto &internals = get_internals();
+    return owner == &internals && generation == internals.type_registry_generation;
+}
+
+inline void type_registry_version::update() {
+    auto &internals = get_internals();
+    owner = &internals;
+    generation = internals.type_registry_generation;
+}
+
 /// Works like `internals.registered_types_cpp`, but for module-local registered types:
 inline type_map<type_info *> &registered_local_types_cpp() {
     static type_map<type_info *> locals{};
@@ -13,20 +13,18 @@
 
 #include "pybind11.h"
 
+#include <list>
+
 PYBIND11_NAMESPACE_BEGIN(PYBIND11_NAMESPACE)
 PYBIND11_NAMESPACE_BEGIN(detail)
 
 inline void ensure_builtins_in_globals(object &global) {
-    #if PY_VERSION_HEX < 0x03080000
-        // Running exec and eval on Python 2 and 3 adds `builtins` module under
-        // `__builtins__` key to globals if not yet present.
-        // Python 3.8 made PyRun_String behave similarly. Let's also do that for
-        // older versions, for consistency.
-        if (!global.contains("__builtins__"))
-            global["__builtins__"] = module_::import(PYBIND11_BUILTINS_MODULE);
-    #else
-        (void) global;
-    #endif
+    // Running exec and eval on Python 2 and 3 adds `builtins` module under
+    // `__builtins__` key to globals if not yet present.
+    // Python 3.8 made PyRun_String behave similarly (but not PyEval_EvalCode).
+    // Let's also do that for older versions and code objects, for consistency.
+    if (!global.contains("__builtins__"))
+        global["__builtins__"] = module_::import(PYBIND11_BUILTINS_MODULE);
 }
 
 PYBIND11_NAMESPACE_END(detail)
@@ -42,31 +40,125 @@ enum eval_mode {
     eval_statements
 };
 
-template <eval_mode mode = eval_expr>
-object eval(str expr, object global = globals(), object local = object()) {
-    if (!local)
-        local = global;
+/// A Python code object, compiled once by `compile()` and evaluated any number of times by `eval()`
+class compiled_code : public object {
+public:
+    PYBIND11_OBJECT_DEFAULT(compiled_code, object, PyCode_Check)
+};
 
-    detail::ensure_builtins_in_globals(global);
+PYBIND11_NAMESPACE_BEGIN(detail)
 
-    /* PyRun_String does not accept a PyObject / encoding specifier,
+inline int eval_start_symbol(eval_mode mode) {
+    switch (mode) {
+        case eval_expr:             return Py_eval_input;
+        case eval_single_statement: return Py_single_input;
+        case eval_statements:       return Py_file_input;
+        default: pybind11_fail("invalid evaluation mode");
+    }
+}
+
+inline compiled_code compile(const str &expr, eval_mode mode, const char *filename) {
+    /* Py_CompileString does not accept a PyObject / encoding specifier,
        this seems to be the only alternative */
     std::string buffer = "# -*- coding: utf-8 -*-\n" + (std::string) expr;
 
-    int start;
-    switch (mode) {
-        case eval_expr:             start = Py_eval_input;   break;
-        case eval_single_statement: start = Py_single_input; break;
-        case eval_statements:       start = Py_file_input;   break;
-        default: pybind11_fail("invalid evaluation mode");
+    PyObject *result = Py_CompileString(buffer.c_str(), filename, eval_start_symbol(mode));
+    if (!result)
+        throw error_already_set();
+    return reinterpret_steal<compiled_code>(result);
+}
+
+/// Code objects compiled by `eval()` and `exec()`, most recently used first (see `set_eval_cache_size()`)
+struct eval_cache {
+    using entry = std::pair<std::string, compiled_code>;
+    size_t max_size = 0;
+    std::list<entry> entries;
+    std::unordered_map<std::string, std::list<entry>::iterator> index;
+};
+
+/// Kept with the internals, so that it is dropped along with the interpreter when embedding
+inline eval_cache &get_eval_cache() {
+    return get_or_create_shared_data<eval_cache>("_pybind11_eval_cache");
+}
+
+/// Compiles `expr`, or returns the code compiled for it before if it is in the eval cache
+inline compiled_code compile_cached(const str &expr, eval_mode mode) {
+    auto &cache = get_eval_cache();
+    if (cache.max_size == 0)
+        return compile(expr, mode, "<string>");
+
+    auto key = std::to_string((int) mode) + ":" + (std::string) expr;
+    auto it = cache.index.find(key);
+    if (it != cache.index.end()) {
+        cache.entries.splice(cache.entries.begin(), cache.entries, it->second);
+        return it->second->second;
+    }
+
+    auto code = compile(expr, mode, "<string>");
+    cache.entries.emplace_front(key, code);
+    cache.index[std::move(key)] = cache.entries.begin();
+    while (cache.entries.size() > cache.max_size) {
+        cache.index.erase(cache.entries.back().first);
+        cache.entries.pop_back();
+    }
+    return code;
+}
+
+PYBIND11_NAMESPACE_END(detail)
+
+/** \rst
+    Sets the number of code objects compiled by ``eval()`` and ``exec()`` (from strings) which are
+    kept for reuse when the same string is evaluated again, least recently used first out. The
+    default, 0, disables the cache.
+\endrst */
+inline void set_eval_cache_size(size_t size) {
+    auto &cache = detail::get_eval_cache();
+    cache.max_size = size;
+    while (cache.entries.size() > size) {
+        cache.index.erase(cache.entries.back().first);
+        cache.entries.pop_back();
     }
+}
+
+/// Compiles a string (following `mode`) into a code object which can be evaluated by `eval()`
+template <eval_mode mode = eval_expr>
+compiled_code compile(str expr, const char *filename = "<string>") {
+    return detail::compile(expr, mode, filename);
+}
+
+template <eval_mode mode = eval_expr, size_t N>
+compiled_code compile(const char (&s)[N], const char *filename = "<string>") {
+    /* Support raw string literals by removing common leading whitespace */
+    auto expr = (s[0] == '\n') ? str(module_::import("textwrap").attr("dedent")(s))
+                               : str(s);
+    return compile<mode>(expr, filename);
+}
+
+/// Evaluates a compiled code object (`mode` is ignored: it is given when compiling). Only takes a
+/// `compiled_code` (not objects convertible to it, which go to the `str` overload).
+template <eval_mode mode = eval_expr, typename Code,
+          detail::enable_if_t<std::is_same<Code, compiled_code>::value, int> = 0>
+object eval(const Code &code, object global = globals(), object local = object()) {
+    if (!local)
+        local = global;
+
+    detail::ensure_builtins_in_globals(global);
 
-    PyObject *result = PyRun_String(buffer.c_str(), start, global.ptr(), local.ptr());
+#if PY_MAJOR_VERSION >= 3
+    PyObject *result = PyEval_EvalCode(code.ptr(), global.ptr(), local.ptr());
+#else
+    PyObject *result = PyEval_EvalCode((PyCodeObject *) code.ptr(), global.ptr(), local.ptr());
+#endif
     if (!result)
         throw error_already_set();
     return reinterpret_steal<object>(result);
 }
 
+template <eval_mode mode = eval_expr>
+object eval(str expr, object global = globals(), object local = object()) {
+    return eval(detail::compile_cached(expr, mode), std::move(global), std::move(local));
+}
+
 template <eval_mode mode = eval_expr, size_t N>
 object eval(const char (&s)[N], object global = globals(), object local = object()) {
     /* Support raw string literals by removing common leading whitespace */
@@ -79,6 +171,11 @@ inline void exec(str expr, object global = globals(), object local = object()) {
     eval<eval_statements>(expr, global, local);
 }
 
+template <typename Code, detail::enable_if_t<std::is_same<Code, compiled_code>::value, int> = 0>
+void exec(const Code &code, object global = globals(), object local = object()) {
+    eval(code, global, local);
+}
+
 template <size_t N>
 void exec(const char (&s)[N], object global = globals(), object local = object()) {
     eval<eval_statements>(s, global, local);
@@ -105,13 +202,7 @@ object eval_file(str fname, object global = globals(), object local = object())
 
     detail::ensure_builtins_in_globals(global);
 
-    int start;
-    switch (mode) {
-        case eval_expr:             start = Py_eval_input;   break;
-        case eval_single_statement: start = Py_single_input; break;
-        case eval_statements:       start = Py_file_input;   break;
-        default: pybind11_fail("invalid evaluation mode");
-    }
+    int start = detail::eval_start_symbol(mode);
 
     int closeFile = 1;
     std::string fname_str = (std::string) fname;
@@ -63,13 +63,23 @@ private:
         return _sync();
     }
 
+    static const interned_str &write_key() {
+        static const interned_str key("write");
+        return key;
+    }
+
+    static const interned_str &flush_key() {
+        static const interned_str key("flush");
+        return key;
+    }
+
 public:
 
     pythonbuf(object pyostream, size_t buffer_size = 1024)
         : buf_size(buffer_size),
           d_buffer(new char[buf_size]),
-          pywrite(pyostream.attr("write")),
-          pyflush(pyostream.attr("flush")) {
+          pywrite(pyostream.attr(write_key())),
+          pyflush(pyostream.attr(flush_key())) {
         setp(d_buffer.get(), d_buffer.get() + buf_size - 1);
     }
 
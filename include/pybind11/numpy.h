@@ -19,7 +19,9 @@
 #include <cstring>
 #include <sstream>
 #include <string>
+#include <thread>
 #include <functional>
+#include <limits>
 #include <type_traits>
 #include <utility>
 #include <vector>
@@ -457,6 +459,107 @@ struct type_caster<unchecked_reference<T, Dim>> {
 template <typename T, ssize_t Dim>
 struct type_caster<unchecked_mutable_reference<T, Dim>> : type_caster<unchecked_reference<T, Dim>> {};
 
+/// A mapping of a `multiprocessing.shared_memory.SharedMemory` segment, kept alive by a capsule
+/// that is the base of the arrays using it.  The process that created the segment unlinks it
+/// once the last of its arrays using it is destroyed.
+struct shared_memory_segment {
+    static const char *capsule_name() { return "pybind11_shared_memory"; }
+
+    object shm;
+    char *data;
+    ssize_t size;
+    bool owner;
+
+    shared_memory_segment(object shm_, bool owner_) : shm(std::move(shm_)), owner(owner_) {
+        auto info = reinterpret_borrow<buffer>(shm.attr("buf")).request();
+        data = static_cast<char *>(info.ptr);
+        size = info.size * info.itemsize;
+    }
+
+    /// Creates a new segment of (at least) `size` bytes
+    static capsule create(ssize_t size) {
+        auto type = module_::import("multiprocessing.shared_memory").attr("SharedMemory");
+        // Zero-sized segments are not supported
+        auto segment = new shared_memory_segment(type(arg("create") = true,
+                                                      arg("size") = (std::max)(size, ssize_t(1))),
+                                                 true);
+        auto result = wrap(segment);
+#if PY_VERSION_HEX < 0x030D0000
+        created().insert(segment->shm.attr("_name").cast<std::string>());
+#endif
+        return result;
+    }
+
+    /// Maps the existing segment called `name`
+    static capsule attach(const object &name) {
+        auto shared_memory = module_::import("multiprocessing.shared_memory");
+        auto type = shared_memory.attr("SharedMemory");
+        // Only the process that created the segment may unlink it
+#if PY_VERSION_HEX >= 0x030D0000
+        return wrap(new shared_memory_segment(type(name, arg("track") = false), false));
+#else
+        // Before Python 3.13, attaching registers the segment with the resource tracker, which
+        // would unlink it when this process exits (unless this process created it, in which case
+        // unlinking it unregisters it)
+        object shm = type(name);
+        if (shared_memory.attr("_USE_POSIX").cast<bool>() &&
+            !created().count(shm.attr("_name").cast<std::string>())) {
+            auto tracker = module_::import("multiprocessing.resource_tracker");
+            tracker.attr("unregister")(shm.attr("_name"), "shared_memory");
+        }
+        return wrap(new shared_memory_segment(std::move(shm), false));
+#endif
+    }
+
+    /// Returns the segment used by the array `h` (or one of its bases), or nullptr
+    static shared_memory_segment *of(handle h) {
+        while (npy_api::get().PyArray_Check_(h.ptr()) && array_proxy(h.ptr())->base)
+            h = array_proxy(h.ptr())->base;
+        if (!PyCapsule_IsValid(h.ptr(), capsule_name()))
+            return nullptr;
+        return static_cast<shared_memory_segment *>(PyCapsule_GetPointer(h.ptr(), capsule_name()));
+    }
+
+    /// Checks that an array starting at `offset` bytes into the segment fits into it
+    bool contains(ssize_t offset, const std::vector<ssize_t> &shape, const std::vector<ssize_t> &strides,
+                  ssize_t itemsize) const {
+        ssize_t lo = offset, hi = offset + itemsize;
+        for (size_t i = 0; i < shape.size(); ++i) {
+            if (shape[i] == 0)
+                return offset >= 0 && offset <= size;
+            (strides[i] < 0 ? lo : hi) += (shape[i] - 1) * strides[i];
+        }
+        return lo >= 0 && hi <= size;
+    }
+
+private:
+#if PY_VERSION_HEX < 0x030D0000
+    /// Names of the segments created by this process that are not unlinked yet
+    static std::unordered_set<std::string> &created() {
+        static std::unordered_set<std::string> names;
+        return names;
+    }
+#endif
+
+    static capsule wrap(shared_memory_segment *segment) {
+        return capsule(segment, capsule_name(), [](PyObject *o) {
+            auto segment = static_cast<shared_memory_segment *>(PyCapsule_GetPointer(o, capsule_name()));
+            error_scope scope; // Preserve any error pending while the capsule is destroyed
+            if (segment->owner) {
+                try {
+#if PY_VERSION_HEX < 0x030D0000
+                    created().erase(segment->shm.attr("_name").cast<std::string>());
+#endif
+                    segment->shm.attr("unlink")();
+                } catch (error_already_set &e) {
+                    e.discard_as_unraisable("pybind11::detail::shared_memory_segment");
+                }
+            }
+            delete segment;
+        });
+    }
+};
+
 PYBIND11_NAMESPACE_END(detail)
 
 class dtype : public object {
@@ -779,6 +882,130 @@ public:
         if (isinstance<array>(new_array)) { *this = std::move(new_array); }
     }
 
+    /// Create an array in a new shared memory segment (`multiprocessing.shared_memory`, Python
+    /// 3.8+), whose `shared_memory_descriptor()` other processes can use to map the same memory.
+    static array shared(const pybind11::dtype &dt, ShapeContainer shape, StridesContainer strides = {}) {
+        if (strides->empty())
+            *strides = detail::c_strides(*shape, dt.itemsize());
+        if (shape->size() != strides->size())
+            pybind11_fail("NumPy: shape ndim doesn't match strides ndim");
+        // Place the first element so that negative strides stay inside the segment
+        ssize_t lo = 0, hi = dt.itemsize();
+        for (size_t i = 0; i < shape->size(); ++i)
+            ((*strides)[i] < 0 ? lo : hi) += ((*shape)[i] > 0 ? (*shape)[i] - 1 : 0) * (*strides)[i];
+        auto segment = detail::shared_memory_segment::create(hi - lo);
+        auto data = static_cast<detail::shared_memory_segment *>(
+            PyCapsule_GetPointer(segment.ptr(), detail::shared_memory_segment::capsule_name()))->data - lo;
+        return array(dt, std::move(shape), std::move(strides), data, segment);
+    }
+
+    /// Whether the array is in shared memory (see `shared()`)
+    bool is_shared_memory() const {
+        return detail::shared_memory_segment::of(m_ptr) != nullptr;
+    }
+
+    /// Return a small picklable object describing an array in shared memory (see `shared()`),
+    /// from which `from_shared_memory()` creates a view of the same data in any process, as
+    /// long as the original array (or a view of it) is alive.
+    object shared_memory_descriptor() const {
+        auto segment = detail::shared_memory_segment::of(m_ptr);
+        if (!segment)
+            throw value_error("array is not in shared memory");
+        return make_tuple(segment->shm.attr("name"), dtype(), attr("shape"), attr("strides"),
+                          static_cast<const char *>(data()) - segment->data);
+    }
+
+    /// Create an array using the shared memory described by `descriptor` (see
+    /// `shared_memory_descriptor()`).  Arrays created from the same segment in the same process
+    /// share a single mapping of it only if they are views of each other.
+    static array from_shared_memory(handle descriptor) {
+        if (!isinstance<tuple>(descriptor) || len(descriptor) != 5)
+            throw value_error("invalid shared memory descriptor");
+        auto t = reinterpret_borrow<tuple>(descriptor);
+        auto dt = t[1].cast<pybind11::dtype>();
+        std::vector<ssize_t> shape, strides;
+        for (auto n : t[2])
+            shape.push_back(n.cast<ssize_t>());
+        for (auto n : t[3])
+            strides.push_back(n.cast<ssize_t>());
+        auto offset = t[4].cast<ssize_t>();
+        auto segment = detail::shared_memory_segment::attach(t[0]);
+        auto s = static_cast<detail::shared_memory_segment *>(
+            PyCapsule_GetPointer(segment.ptr(), detail::shared_memory_segment::capsule_name()));
+        if (shape.size() != strides.size() || !s->contains(offset, shape, strides, dt.itemsize()))
+            throw value_error("invalid shared memory descriptor");
+        return array(dt, std::move(shape), std::move(strides), s->data + offset, segment);
+    }
+
+    /// Expected access pattern of a memory-mapped array (see `from_mmap()`)
+    enum class mmap_advice { normal, sequential, random };
+
+    /// Create an array mapping `shape` elements of type `dt` from the file at `path`, starting
+    /// `offset` bytes into the file.  If `shape` is empty, the array is one-dimensional and covers
+    /// the rest of the file.  As for `numpy.memmap`, `mode` is "r" (read-only), "r+" (changes are
+    /// written to the file) or "c" (copy-on-write).  The file is only paged in as the array is
+    /// accessed, and unmapped once the array and its views are destroyed.  `advice` is passed on
+    /// to `madvise()` where available (Python 3.8+ on Unix).
+    static array from_mmap(const std::string &path, const pybind11::dtype &dt, ShapeContainer shape = {},
+                           ssize_t offset = 0, const std::string &mode = "r",
+                           mmap_advice advice = mmap_advice::normal) {
+        auto mmap = module_::import("mmap");
+        object access;
+        if (mode == "r")
+            access = mmap.attr("ACCESS_READ");
+        else if (mode == "r+")
+            access = mmap.attr("ACCESS_WRITE");
+        else if (mode == "c")
+            access = mmap.attr("ACCESS_COPY");
+        else
+            throw value_error("invalid mmap mode \"" + mode + "\" (expected \"r\", \"r+\" or \"c\")");
+        if (offset < 0)
+            throw value_error("mmap offset must be non-negative");
+
+        auto file = module_::import("io").attr("open")(path, mode == "r+" ? "r+b" : "rb");
+        object map;
+        try {
+            auto file_size = file.attr("seek")(0, 2).cast<ssize_t>();
+            if (shape->empty()) {
+                if (offset > file_size)
+                    throw value_error("mmap offset is larger than the file");
+                shape->push_back((file_size - offset) / dt.itemsize());
+            }
+            auto nbytes = std::accumulate(shape->begin(), shape->end(), dt.itemsize(), std::multiplies<ssize_t>());
+            if (offset + nbytes > file_size)
+                throw value_error("file is too small for the requested array");
+            if (nbytes == 0) {
+                file.attr("close")();
+                return array(dt, std::move(shape));
+            }
+            // The mapping has to start at a multiple of the allocation granularity
+            auto start = offset - offset % mmap.attr("ALLOCATIONGRANULARITY").cast<ssize_t>();
+            map = mmap.attr("mmap")(file.attr("fileno")(), offset - start + nbytes,
+                                    arg("access") = access, arg("offset") = start);
+            offset -= start;
+        } catch (...) {
+            file.attr("close")();
+            throw;
+        }
+        file.attr("close")();
+
+        if (advice != mmap_advice::normal && hasattr(map, "madvise")) {
+            auto name = advice == mmap_advice::sequential ? "MADV_SEQUENTIAL" : "MADV_RANDOM";
+            if (hasattr(mmap, name))
+                map.attr("madvise")(mmap.attr(name));
+        }
+
+        // The memoryview keeps the mapping open (`mmap.close()` fails while it is exported)
+        auto view = reinterpret_steal<object>(PyMemoryView_FromObject(map.ptr()));
+        if (!view)
+            throw error_already_set();
+        auto ptr = static_cast<char *>(reinterpret_borrow<buffer>(view).request().ptr) + offset;
+        array result(dt, std::move(shape), {}, ptr, view);
+        if (mode == "r")
+            detail::array_proxy(result.ptr())->flags &= ~detail::npy_api::NPY_ARRAY_WRITEABLE_;
+        return result;
+    }
+
     /// Ensure that the argument is a NumPy array
     /// In case of an error, nullptr is returned and the Python error is cleared.
     static array ensure(handle h, int ExtraFlags = 0) {
@@ -832,12 +1059,85 @@ protected:
     }
 };
 
+/// An allocator of memory aligned to `Alignment` bytes (a power of two, at least the alignment of
+/// `T` and of a pointer), e.g. 64 for AVX-512 loads, for use with `array_t(shape, allocator)`.
+/// The memory is not initialized.
+template <typename T, size_t Alignment> class aligned_allocator {
+    static_assert(Alignment > 0 && (Alignment & (Alignment - 1)) == 0, "Alignment must be a power of two");
+    static_assert(Alignment >= alignof(T), "Alignment must be at least the alignment of T");
+    // The pointer to free is stored in front of the aligned block
+    static_assert(Alignment >= alignof(void *), "Alignment must be at least the alignment of a pointer");
+
+public:
+    using value_type = T;
+    template <typename U> struct rebind { using other = aligned_allocator<U, Alignment>; };
+
+    aligned_allocator() = default;
+    template <typename U> aligned_allocator(const aligned_allocator<U, Alignment> &) { }
+
+    T *allocate(size_t n) {
+        // Store the pointer to free in front of the aligned block
+        auto bytes = n * sizeof(T) + Alignment + sizeof(void *);
+        if (n > (std::numeric_limits<size_t>::max() - Alignment - sizeof(void *)) / sizeof(T))
+            throw std::bad_alloc();
+        void *block = std::malloc(bytes);
+        if (!block)
+            throw std::bad_alloc();
+        auto address = reinterpret_cast<std::uintptr_t>(block) + sizeof(void *);
+        auto aligned = reinterpret_cast<void **>((address + Alignment - 1) & ~std::uintptr_t(Alignment - 1));
+        aligned[-1] = block;
+        return reinterpret_cast<T *>(aligned);
+    }
+
+    void deallocate(T *p, size_t) noexcept {
+        if (p)
+            std::free(reinterpret_cast<void **>(p)[-1]);
+    }
+
+    template <typename U> bool operator==(const aligned_allocator<U, Alignment> &) const { return true; }
+    template <typename U> bool operator!=(const aligned_allocator<U, Alignment> &) const { return false; }
+};
+
+PYBIND11_NAMESPACE_BEGIN(detail)
+template <typename A, typename = void> struct is_allocator : std::false_type {};
+template <typename A>
+struct is_allocator<A, void_t<typename A::value_type, decltype(std::declval<A &>().allocate(size_t{}))>>
+    : std::true_type {};
+PYBIND11_NAMESPACE_END(detail)
+
 template <typename T, int ExtraFlags = array::forcecast> class array_t : public array {
 private:
     struct private_ctor {};
     // Delegating constructor needed when both moving and accessing in the same constructor
     array_t(private_ctor, ShapeContainer &&shape, StridesContainer &&strides, const T *ptr, handle base)
         : array(std::move(shape), std::move(strides), ptr, base) {}
+
+    /// Memory obtained from an allocator, given back to it on destruction
+    template <typename Allocator> struct allocation {
+        using allocator_type = typename std::allocator_traits<Allocator>::template rebind_alloc<T>;
+        allocator_type allocator;
+        size_t count;
+        T *ptr;
+
+        allocation(const Allocator &allocator_, size_t count_)
+            : allocator(allocator_), count(count_),
+              ptr(std::allocator_traits<allocator_type>::allocate(allocator, count)) { }
+        ~allocation() { std::allocator_traits<allocator_type>::deallocate(allocator, ptr, count); }
+    };
+
+    /// Allocates room for the elements of an array of the given shape, owned by the returned capsule
+    template <typename Allocator>
+    static std::pair<T *, capsule> allocate(const Allocator &allocator, const std::vector<ssize_t> &shape) {
+        auto count = std::accumulate(shape.begin(), shape.end(), ssize_t(1), std::multiplies<ssize_t>());
+        // Empty arrays still need a (non-null) pointer
+        std::unique_ptr<allocation<Allocator>> mem(
+            new allocation<Allocator>(allocator, static_cast<size_t>((std::max)(count, ssize_t(1)))));
+        capsule owner(mem.get(), [](void *p) { delete static_cast<allocation<Allocator> *>(p); });
+        return {mem.release()->ptr, std::move(owner)};
+    }
+
+    array_t(private_ctor, ShapeContainer &&shape, std::pair<T *, capsule> &&mem)
+        : array_t(std::move(shape), mem.first, mem.second) { }
 public:
     static_assert(!detail::array_info<T>::is_array, "Array types cannot be used with array_t");
 
@@ -872,6 +1172,16 @@ public:
     explicit array_t(ssize_t count, const T *ptr = nullptr, handle base = handle())
         : array({count}, {}, ptr, base) { }
 
+    /// Construct an array whose (uninitialized) memory is obtained from `allocator` (e.g. an
+    /// `aligned_allocator`) and given back to it once the array and its views are destroyed.
+    template <typename Allocator, detail::enable_if_t<detail::is_allocator<Allocator>::value, int> = 0>
+    array_t(ShapeContainer shape, const Allocator &allocator)
+        : array_t(private_ctor{}, std::move(shape), allocate(allocator, *shape)) { }
+
+    template <typename Allocator, detail::enable_if_t<detail::is_allocator<Allocator>::value, int> = 0>
+    array_t(ssize_t count, const Allocator &allocator)
+        : array_t(ShapeContainer{count}, allocator) { }
+
     constexpr ssize_t itemsize() const {
         return sizeof(T);
     }
@@ -932,6 +1242,32 @@ public:
         return result;
     }
 
+    /// Create an array in a new shared memory segment (see `array::shared()`)
+    static array_t shared(ShapeContainer shape) {
+        auto strides = ExtraFlags & f_style ? detail::f_strides(*shape, sizeof(T))
+                                            : detail::c_strides(*shape, sizeof(T));
+        return reinterpret_steal<array_t>(
+            array::shared(pybind11::dtype::of<T>(), std::move(shape), std::move(strides)).release());
+    }
+
+    /// Create an array using the shared memory described by `descriptor` (see
+    /// `array::from_shared_memory()`).  Throws if the array doesn't match this type.
+    static array_t from_shared_memory(handle descriptor) {
+        auto result = array::from_shared_memory(descriptor);
+        if (!check_(result))
+            throw type_error("shared memory array has an incompatible dtype or layout");
+        return reinterpret_steal<array_t>(result.release());
+    }
+
+    /// Create a (C-contiguous) array mapping the file at `path` (see `array::from_mmap()`)
+    static array_t from_mmap(const std::string &path, ShapeContainer shape = {}, ssize_t offset = 0,
+                             const std::string &mode = "r", mmap_advice advice = mmap_advice::normal) {
+        auto result = array::from_mmap(path, pybind11::dtype::of<T>(), std::move(shape), offset, mode, advice);
+        if (!check_(result))
+            throw type_error("a memory-mapped array is C-contiguous");
+        return reinterpret_steal<array_t>(result.release());
+    }
+
     static bool check_(handle h) {
         const auto &api = detail::npy_api::get();
         return api.PyArray_Check_(h.ptr())
@@ -952,6 +1288,151 @@ protected:
     }
 };
 
+PYBIND11_NAMESPACE_BEGIN(detail)
+/// The rows `[begin, end)` of an unchecked reference, as a reference of the same type
+template <typename Ref> struct unchecked_rows : Ref {
+    // Copy of the shape for runtime dimensions (where the reference only points to it)
+    std::vector<ssize_t> shape_copy;
+
+    unchecked_rows(const Ref &ref, ssize_t begin, ssize_t end) : Ref(ref) {
+        this->data_ += begin * this->strides_[0];
+        set_rows(this->shape_, end - begin);
+    }
+    unchecked_rows(const unchecked_rows &) = delete;
+
+private:
+    template <size_t N> void set_rows(std::array<ssize_t, N> &shape, ssize_t rows) { shape[0] = rows; }
+    void set_rows(const ssize_t *&shape, ssize_t rows) {
+        shape_copy.assign(shape, shape + this->ndim());
+        shape_copy[0] = rows;
+        shape = shape_copy.data();
+    }
+};
+
+/// Number of blocks `parallel_blocks` splits `n` rows into: at most one per thread, and few enough
+/// for each block to have at least `grain` rows (a single block if there are fewer rows than that)
+inline size_t parallel_block_count(ssize_t n, ssize_t grain, size_t threads) {
+    if (threads == 0)
+        threads = (std::max)(std::thread::hardware_concurrency(), 1u);
+    auto max_blocks = static_cast<size_t>(n / (std::max)(grain, ssize_t(1)));
+    return (std::max)((std::min)(threads, max_blocks), size_t(1));
+}
+
+/// Calls `f(begin, end, block)` for each of `blocks` contiguous blocks of rows `[begin, end)`
+/// partitioning `[0, n)`, one thread per block, with the GIL released.  Exceptions thrown by `f`
+/// are rethrown once all the blocks are done.  If no more threads can be started (in particular
+/// when the module isn't linked with the threads library), the remaining blocks run serially.
+template <typename Func> void parallel_blocks(ssize_t n, size_t blocks, const Func &f) {
+    std::vector<std::exception_ptr> errors(blocks);
+    auto run = [&](size_t block) {
+        try {
+            f(n * ssize_t(block) / ssize_t(blocks), n * ssize_t(block + 1) / ssize_t(blocks), block);
+        } catch (...) {
+            errors[block] = std::current_exception();
+        }
+    };
+    {
+        gil_scoped_release release;
+        std::vector<std::thread> workers;
+        size_t started = 1;
+        try {
+            workers.reserve(blocks - 1);
+            for (; started < blocks; ++started)
+                workers.emplace_back(run, started);
+        } catch (...) {
+            // Out of threads (or memory): run the remaining blocks on this one
+        }
+        run(0);
+        for (size_t block = started; block < blocks; ++block)
+            run(block);
+        for (auto &worker : workers)
+            worker.join();
+    }
+    for (auto &error : errors)
+        if (error)
+            std::rethrow_exception(error);
+}
+PYBIND11_NAMESPACE_END(detail)
+
+/**
+ * Calls `f(rows, begin)` in parallel for blocks of consecutive rows (indices along the first axis)
+ * of `a`, where `rows` is a mutable unchecked reference (see `mutable_unchecked()`) to the rows
+ * from `begin` on, indexed from 0.  Each block (at least `grain` rows) runs on its own thread, up
+ * to `threads` (by default, the number of hardware threads) including the calling one.  The GIL is
+ * released meanwhile, so `f` must not use the Python API; a reference to `a` is held until all the
+ * blocks are done.  The first exception thrown by `f` is rethrown afterwards.  The module must be
+ * linked with the threads library (`Threads::Threads` in CMake), or the blocks run serially.
+ */
+template <ssize_t Dims = -1, typename T, int ExtraFlags, typename Func>
+void parallel_for(array_t<T, ExtraFlags> &a, const Func &f, ssize_t grain = 1, size_t threads = 0) {
+    array_t<T, ExtraFlags> keep_alive = a;
+    auto view = keep_alive.template mutable_unchecked<Dims>();
+    if (view.ndim() == 0)
+        throw std::domain_error("parallel_for requires an array with at least one dimension");
+    detail::parallel_blocks(view.shape(0), detail::parallel_block_count(view.shape(0), grain, threads),
+                            [&](ssize_t begin, ssize_t end, size_t) {
+        detail::unchecked_rows<decltype(view)> rows(view, begin, end);
+        f(static_cast<decltype(view) &>(rows), begin);
+    });
+}
+
+/// Like the above, but for read-only access: `rows` is an unchecked reference (see `unchecked()`).
+template <ssize_t Dims = -1, typename T, int ExtraFlags, typename Func>
+void parallel_for(const array_t<T, ExtraFlags> &a, const Func &f, ssize_t grain = 1, size_t threads = 0) {
+    array_t<T, ExtraFlags> keep_alive = a;
+    auto view = keep_alive.template unchecked<Dims>();
+    if (view.ndim() == 0)
+        throw std::domain_error("parallel_for requires an array with at least one dimension");
+    detail::parallel_blocks(view.shape(0), detail::parallel_block_count(view.shape(0), grain, threads),
+                            [&](ssize_t begin, ssize_t end, size_t) {
+        detail::unchecked_rows<decltype(view)> rows(view, begin, end);
+        f(static_cast<const decltype(view) &>(rows), begin);
+    });
+}
+
+/**
+ * Reduces the rows of `a` in parallel, as `parallel_for` (read-only) does: each thread starts from a
+ * copy of `identity` and calls `f(rows, begin, acc)` to accumulate its block of rows into `acc`.
+ * The accumulators are then combined in the order of the rows, with `acc = combine(acc, next)`,
+ * so that the result only depends on the number of blocks.
+ */
+template <ssize_t Dims = -1, typename T, int ExtraFlags, typename Acc, typename Func, typename Combine>
+Acc parallel_reduce(const array_t<T, ExtraFlags> &a, const Acc &identity, const Func &f, const Combine &combine,
+                    ssize_t grain = 1, size_t threads = 0) {
+    array_t<T, ExtraFlags> keep_alive = a;
+    auto view = keep_alive.template unchecked<Dims>();
+    if (view.ndim() == 0)
+        throw std::domain_error("parallel_reduce requires an array with at least one dimension");
+    // Not a plain std::vector<Acc>, which wouldn't work for Acc = bool
+    struct accumulator { Acc value; };
+    std::vector<accumulator> accs(detail::parallel_block_count(view.shape(0), grain, threads), accumulator{identity});
+    detail::parallel_blocks(view.shape(0), accs.size(), [&](ssize_t begin, ssize_t end, size_t block) {
+        detail::unchecked_rows<decltype(view)> rows(view, begin, end);
+        f(static_cast<const decltype(view) &>(rows), begin, accs[block].value);
+    });
+    Acc result = std::move(accs[0].value);
+    for (size_t i = 1; i < accs.size(); ++i)
+        result = combine(std::move(result), std::move(accs[i].value));
+    return result;
+}
+
+/**
+ * Zero-fills `a` in parallel, with the same blocks of rows as `parallel_for(a, f, grain, threads)`.
+ * Operating systems usually place a page of memory on the NUMA node of the thread that first
+ * writes to it, so calling this on a new array spreads its pages across the nodes the threads ran
+ * on, rather than placing all of them on the node of the thread holding the GIL.  The threads are
+ * not pinned: whether a block later runs on the node holding its pages is up to the scheduler.
+ * This is just a parallel fill on machines with a single node.  The array must be C-contiguous.
+ */
+template <typename T, int ExtraFlags>
+void parallel_first_touch(array_t<T, ExtraFlags> &a, ssize_t grain = 1, size_t threads = 0) {
+    if (!detail::check_flags(a.ptr(), array::c_style))
+        throw std::domain_error("parallel_first_touch requires a C-contiguous array");
+    parallel_for(a, [](detail::unchecked_mutable_reference<T, -1> &rows, ssize_t) {
+        std::memset(static_cast<void *>(rows.mutable_data()), 0, static_cast<size_t>(rows.nbytes()));
+    }, grain, threads);
+}
+
 template <typename T>
 struct format_descriptor<T, detail::enable_if_t<detail::is_pod_struct<T>::value>> {
     static std::string format() {
@@ -38,12 +38,18 @@ public:
 
     options& enable_function_signatures() & { global_state().show_function_signatures = true; return *this; }
 
+    options& disable_default_gil_release() & { global_state().default_gil_release = false; return *this; }
+
+    options& enable_default_gil_release() & { global_state().default_gil_release = true; return *this; }
+
     // Getter methods (return the global state):
 
     static bool show_user_defined_docstrings() { return global_state().show_user_defined_docstrings; }
 
     static bool show_function_signatures() { return global_state().show_function_signatures; }
 
+    static bool default_gil_release() { return global_state().default_gil_release; }
+
     // This type is not meant to be allocated on the heap.
     void* operator new(size_t) = delete;
 
@@ -52,6 +58,7 @@ private:
     struct state {
         bool show_user_defined_docstrings = true;  //< Include user-supplied texts in docstrings.
         bool show_function_signatures = true;      //< Include auto-generated function signatures in docstrings.
+        bool default_gil_release = false;          //< Release the GIL while calling functions that don't take or return Python objects.
     };
 
     static state &global_state() {
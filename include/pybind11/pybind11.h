@@ -47,6 +47,8 @@
 #include "detail/class.h"
 #include "detail/init.h"
 
+#include <atomic>
+#include <chrono>
 #include <memory>
 #include <vector>
 #include <string>
@@ -56,10 +58,147 @@
 #  include <cxxabi.h>
 #endif
 
+/// Function signatures and docstrings of the functions bound while a module is initialized are
+/// generated at the end of its initialization (not on first access, which the builtin function
+/// type of bound functions offers no hook for), so that overload chains are only documented once
+#if !defined(PYBIND11_EAGER_DOCSTRINGS)
+#  define PYBIND11_DEFERRED_DOCSTRINGS
+#endif
+
 PYBIND11_NAMESPACE_BEGIN(PYBIND11_NAMESPACE)
+PYBIND11_NAMESPACE_BEGIN(detail)
+
+/// Records the time taken by a step of the initialization of a module (and the number of memory
+/// blocks allocated by Python meanwhile) while its import is profiled by
+/// `pybind11.import_profile.profile_import()`. `kind` and `name` must be static strings.
+class import_profile_scope {
+public:
+    import_profile_scope(const char *kind, handle scope, const char *name)
+        : records(get_internals().import_profile), kind(kind), scope(scope), name(name) {
+        if (records)
+            start();
+    }
+
+    ~import_profile_scope() {
+        if (records)
+            finish();
+    }
+
+private:
+    /// Python's own allocations (not available on PyPy)
+    static ssize_t allocated_blocks() {
+        handle getallocatedblocks = PySys_GetObject(const_cast<char *>("getallocatedblocks"));
+        return getallocatedblocks ? getallocatedblocks().cast<ssize_t>() : 0;
+    }
+
+    PYBIND11_NOINLINE void start() {
+        error_scope error;
+        try {
+            start_blocks = allocated_blocks();
+        } catch (const error_already_set &) {
+            PyErr_Clear();
+        }
+        start_time = std::chrono::steady_clock::now();
+    }
+
+    PYBIND11_NOINLINE void finish() {
+        auto seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start_time).count();
+        error_scope error; // An exception may be propagating
+        try {
+            auto blocks = allocated_blocks() - start_blocks;
+            std::string qualified_name = name;
+            if (scope && PyType_Check(scope.ptr()))
+                qualified_name = str(scope.attr("__module__")).cast<std::string>() + "." +
+#if PY_MAJOR_VERSION >= 3
+                                 str(scope.attr("__qualname__")).cast<std::string>() +
+#else
+                                 str(scope.attr("__name__")).cast<std::string>() +
+#endif
+                                 "." + qualified_name;
+            else if (scope)
+                qualified_name = str(scope.attr("__name__")).cast<std::string>() + "." + qualified_name;
+            auto record = pybind11::make_tuple(kind, qualified_name, seconds, blocks);
+            if (PyList_Append(records, record.ptr()) != 0)
+                throw error_already_set();
+        } catch (const error_already_set &) {
+            PyErr_Clear();
+        }
+    }
+
+    PyObject *records;
+    const char *kind;
+    handle scope;
+    const char *name;
+    std::chrono::steady_clock::time_point start_time;
+    ssize_t start_blocks = 0;
+};
+
+/// Profiles the initialization of a module (see `PYBIND11_MODULE`) if it is imported by
+/// `pybind11.import_profile.profile_import()`, which stores a list for the records in `builtins`
+class import_profile_module {
+public:
+    explicit import_profile_module(const char *name) : previous(enable()), scope("module", handle(), name) { }
+
+    ~import_profile_module() { get_internals().import_profile = previous; }
+
+private:
+    static PyObject *enable() {
+        auto &internals = get_internals();
+        PyObject *previous = internals.import_profile;
+        PyObject *builtins = PyEval_GetBuiltins();
+        // Borrowed: the list is kept alive by `profile_import()` while the module is imported
+        internals.import_profile = builtins ? PyDict_GetItemString(builtins, "__pybind11_import_profile__") : nullptr;
+        return previous;
+    }
+
+    PyObject *previous;
+    import_profile_scope scope;
+};
+
+/// Functions bound while modules are initialized, whose docstrings are generated at the end of
+/// the outermost initialization (see `deferred_docstrings`)
+struct pending_docstrings {
+    int depth = 0;
+    std::vector<object> functions;
+};
+
+inline pending_docstrings &get_pending_docstrings() {
+    static pending_docstrings pending;
+    return pending;
+}
+
+class deferred_docstrings;
+
+/* When an exception is caught, give each registered exception translator a chance to translate it
+   to a Python exception in reverse order of registration.
+
+   A translator may choose to do one of the following:
+
+    - catch the exception and call PyErr_SetString or PyErr_SetObject
+      to set a standard (or custom) Python exception, or
+    - do nothing and let the exception fall through to the next translator, or
+    - delegate translation to the next translator by throwing a new type of exception. */
+inline void translate_active_exception() {
+    auto last_exception = std::current_exception();
+    auto &registered_exception_translators = get_internals().registered_exception_translators;
+    for (auto& translator : registered_exception_translators) {
+        try {
+            translator(last_exception);
+        } catch (...) {
+            last_exception = std::current_exception();
+            continue;
+        }
+        return;
+    }
+    PyErr_SetString(PyExc_SystemError, "Exception escaped from default exception translator!");
+}
+
+PYBIND11_NAMESPACE_END(detail)
 
 /// Wraps an arbitrary C++ function/method/lambda function/.. into a callable Python object
 class cpp_function : public function {
+    friend class detail::deferred_docstrings;
+
 public:
     cpp_function() = default;
     cpp_function(std::nullptr_t) { }
@@ -188,9 +327,10 @@ protected:
             /* Function scope guard -- defaults to the compile-to-nothing `void_type` */
             using Guard = extract_guard_t<Extra...>;
 
-            /* Perform the function call */
+            /* Perform the function call (releasing the GIL if enabled via py::options) */
             handle result = cast_out::cast(
-                std::move(args_converter).template call<Return, Guard>(cap->f), policy, call.parent);
+                std::move(args_converter).template call<Return, Guard>(cap->f, call.func.release_gil),
+                policy, call.parent);
 
             /* Invoke call policy post-call hook */
             process_attributes<Extra...>::postcall(call, result);
@@ -201,6 +341,14 @@ protected:
         /* Process any user-provided function attributes */
         process_attributes<Extra...>::init(extra..., rec);
 
+        /* Release the GIL around the call if requested via py::options and if neither the
+           arguments nor the return value refer to Python objects. A py::call_guard is left in
+           charge of the GIL, since it is constructed within the released section */
+        rec->release_gil = options::default_gil_release() && cast_in::gil_independent &&
+                           !holds_python_object<intrinsic_t<Return>>::value &&
+                           std::is_same<extract_guard_t<Extra...>, void_type>::value &&
+                           !rec->is_new_style_constructor;
+
         {
             constexpr bool has_kw_only_args = any_of<std::is_same<kw_only, Extra>...>::value,
                            has_pos_only_args = any_of<std::is_same<pos_only, Extra>...>::value,
@@ -296,66 +444,21 @@ protected:
         }
 #endif
 
-        /* Generate a proper function signature */
-        std::string signature;
-        size_t type_index = 0, arg_index = 0;
-        for (auto *pc = text; *pc != '\0'; ++pc) {
-            const auto c = *pc;
-
-            if (c == '{') {
-                // Write arg name for everything except *args and **kwargs.
-                if (*(pc + 1) == '*')
-                    continue;
-                // Separator for keyword-only arguments, placed before the kw
-                // arguments start
-                if (rec->nargs_kw_only > 0 && arg_index + rec->nargs_kw_only == args)
-                    signature += "*, ";
-                if (arg_index < rec->args.size() && rec->args[arg_index].name) {
-                    signature += rec->args[arg_index].name;
-                } else if (arg_index == 0 && rec->is_method) {
-                    signature += "self";
-                } else {
-                    signature += "arg" + std::to_string(arg_index - (rec->is_method ? 1 : 0));
-                }
-                signature += ": ";
-            } else if (c == '}') {
-                // Write default value if available.
-                if (arg_index < rec->args.size() && rec->args[arg_index].descr) {
-                    signature += " = ";
-                    signature += rec->args[arg_index].descr;
-                }
-                // Separator for positional-only arguments (placed after the
-                // argument, rather than before like *
-                if (rec->nargs_pos_only > 0 && (arg_index + 1) == rec->nargs_pos_only)
-                    signature += ", /";
-                arg_index++;
-            } else if (c == '%') {
-                const std::type_info *t = types[type_index++];
-                if (!t)
-                    pybind11_fail("Internal error while parsing type signature (1)");
-                if (auto tinfo = detail::get_type_info(*t)) {
-                    handle th((PyObject *) tinfo->type);
-                    signature +=
-                        th.attr("__module__").cast<std::string>() + "." +
-                        th.attr("__qualname__").cast<std::string>(); // Python 3.3+, but we backport it to earlier versions
-                } else if (rec->is_new_style_constructor && arg_index == 0) {
-                    // A new-style `__init__` takes `self` as `value_and_holder`.
-                    // Rewrite it to the proper class type.
-                    signature +=
-                        rec->scope.attr("__module__").cast<std::string>() + "." +
-                        rec->scope.attr("__qualname__").cast<std::string>();
-                } else {
-                    std::string tname(t->name());
-                    detail::clean_type_id(tname);
-                    signature += tname;
-                }
-            } else {
-                signature += c;
-            }
-        }
-
-        if (arg_index != args || types[type_index] != nullptr)
-            pybind11_fail("Internal error while parsing type signature (2)");
+        rec->nargs = (std::uint16_t) args;
+#if defined(PYBIND11_DEFERRED_DOCSTRINGS)
+        // The signature is generated along with the docstring (see `signature_of`)
+#  if defined(_MSC_VER)
+        // The signature text isn't in static storage here (see PYBIND11_DESCR_CONSTEXPR)
+        rec->signature_text = guarded_strdup(text);
+#  else
+        rec->signature_text = text;
+#  endif
+        for (auto t = types; *t != nullptr; ++t)
+            rec->signature_types.push_back(*t);
+        rec->signature_types.push_back(nullptr);
+#else
+        make_signature(rec, text, types, guarded_strdup);
+#endif
 
 #if PY_MAJOR_VERSION < 3
         if (strcmp(rec->name, "__next__") == 0) {
@@ -366,9 +469,7 @@ protected:
             rec->name = guarded_strdup("__nonzero__");
         }
 #endif
-        rec->signature = guarded_strdup(signature.c_str());
         rec->args.shrink_to_fit();
-        rec->nargs = (std::uint16_t) args;
 
         if (rec->sibling && PYBIND11_INSTANCE_METHOD_CHECK(rec->sibling.ptr()))
             rec->sibling = PYBIND11_INSTANCE_METHOD_GET_FUNCTION(rec->sibling.ptr());
@@ -424,7 +525,7 @@ protected:
                         "compile in debug mode for more details"
                     #else
                         "error while attempting to bind " + std::string(rec->is_method ? "instance" : "static") + " method " +
-                        std::string(pybind11::str(rec->scope.attr("__name__"))) + "." + std::string(rec->name) + signature
+                        std::string(pybind11::str(rec->scope.attr("__name__"))) + "." + std::string(rec->name) + signature_of(rec)
                     #endif
                 );
 
@@ -447,52 +548,165 @@ protected:
             }
         }
 
+        /* Install the docstring, or defer it to the end of the initialization of the module (which
+           saves rebuilding it for every overload, and lets signatures name types bound later) */
+        chain_start->show_signatures = options::show_function_signatures();
+        chain_start->show_docstrings = options::show_user_defined_docstrings();
+        auto *func = (PyCFunctionObject *) m_ptr;
+        std::free(const_cast<char *>(func->m_ml->ml_doc));
+        func->m_ml->ml_doc = nullptr;
+#if defined(PYBIND11_DEFERRED_DOCSTRINGS)
+        auto &pending = detail::get_pending_docstrings();
+        if (pending.depth > 0) {
+            if (!chain_start->doc_pending) {
+                chain_start->doc_pending = true;
+                pending.functions.push_back(reinterpret_borrow<object>(m_ptr));
+            }
+        } else
+#endif
+            install_docstring(func);
+
+        if (rec->is_method) {
+            m_ptr = PYBIND11_INSTANCE_METHOD_NEW(m_ptr, rec->scope.ptr());
+            if (!m_ptr)
+                pybind11_fail("cpp_function::cpp_function(): Could not allocate instance method object");
+            Py_DECREF(func);
+        }
+    }
+
+    /// Generates the signature of a function from the signature text and argument types; `dup`
+    /// copies the generated string
+    template <typename Strdup>
+    static void make_signature(detail::function_record *rec, const char *text,
+                               const std::type_info *const *types, Strdup &&dup) {
+        /* Generate a proper function signature */
+        std::string signature;
+        size_t type_index = 0, arg_index = 0;
+        for (auto *pc = text; *pc != '\0'; ++pc) {
+            const auto c = *pc;
+
+            if (c == '{') {
+                // Write arg name for everything except *args and **kwargs.
+                if (*(pc + 1) == '*')
+                    continue;
+                // Separator for keyword-only arguments, placed before the kw
+                // arguments start
+                if (rec->nargs_kw_only > 0 && arg_index + rec->nargs_kw_only == rec->nargs)
+                    signature += "*, ";
+                if (arg_index < rec->args.size() && rec->args[arg_index].name) {
+                    signature += rec->args[arg_index].name;
+                } else if (arg_index == 0 && rec->is_method) {
+                    signature += "self";
+                } else {
+                    signature += "arg" + std::to_string(arg_index - (rec->is_method ? 1 : 0));
+                }
+                signature += ": ";
+            } else if (c == '}') {
+                // Write default value if available.
+                if (arg_index < rec->args.size() && rec->args[arg_index].descr) {
+                    signature += " = ";
+                    signature += rec->args[arg_index].descr;
+                }
+                // Separator for positional-only arguments (placed after the
+                // argument, rather than before like *
+                if (rec->nargs_pos_only > 0 && (arg_index + 1) == rec->nargs_pos_only)
+                    signature += ", /";
+                arg_index++;
+            } else if (c == '%') {
+                const std::type_info *t = types[type_index++];
+                if (!t)
+                    pybind11_fail("Internal error while parsing type signature (1)");
+                if (auto tinfo = detail::get_type_info(*t, false, false /* bind_lazy */)) {
+                    handle th((PyObject *) tinfo->type);
+                    signature +=
+                        th.attr("__module__").cast<std::string>() + "." +
+                        th.attr("__qualname__").cast<std::string>(); // Python 3.3+, but we backport it to earlier versions
+                } else if (auto lazy = detail::get_lazy_type(*t)) {
+                    signature += handle(lazy->scope).attr("__name__").cast<std::string>() + "." + lazy->name;
+                } else if (rec->is_new_style_constructor && arg_index == 0) {
+                    // A new-style `__init__` takes `self` as `value_and_holder`.
+                    // Rewrite it to the proper class type.
+                    signature +=
+                        rec->scope.attr("__module__").cast<std::string>() + "." +
+                        rec->scope.attr("__qualname__").cast<std::string>();
+                } else {
+                    std::string tname(t->name());
+                    detail::clean_type_id(tname);
+                    signature += tname;
+                }
+            } else {
+                signature += c;
+            }
+        }
+
+        if (arg_index != rec->nargs || types[type_index] != nullptr)
+            pybind11_fail("Internal error while parsing type signature (2)");
+        rec->signature = dup(signature.c_str());
+    }
+
+    /// Returns the signature of a function, generating it on first use (with the docstring, or
+    /// for an error message)
+    static const char *signature_of(const detail::function_record *rec) {
+        if (!rec->signature) {
+            auto mutable_rec = const_cast<detail::function_record *>(rec);
+            make_signature(mutable_rec, rec->signature_text, rec->signature_types.data(),
+                           [](const char *s) { return strdup(s); });
+            std::vector<const std::type_info *>().swap(mutable_rec->signature_types);
+        }
+        return rec->signature;
+    }
+
+    /// Generates the docstring of a function object from the signatures and docstrings of the
+    /// functions in its overload chain, and installs it
+    static void install_docstring(PyCFunctionObject *func) {
+        auto chain_start = (detail::function_record *) PyCapsule_GetPointer(func->m_self, nullptr);
+        chain_start->doc_pending = false;
+        bool overloaded = chain_start->next != nullptr;
         std::string signatures;
         int index = 0;
         /* Create a nice pydoc rec including all signatures and
            docstrings of the functions in the overload chain */
-        if (chain && options::show_function_signatures()) {
+        if (overloaded && chain_start->show_signatures) {
             // First a generic signature
-            signatures += rec->name;
+            signatures += chain_start->name;
             signatures += "(*args, **kwargs)\n";
             signatures += "Overloaded function.\n\n";
         }
         // Then specific overload signatures
         bool first_user_def = true;
         for (auto it = chain_start; it != nullptr; it = it->next) {
-            if (options::show_function_signatures()) {
+            if (chain_start->show_signatures) {
                 if (index > 0) signatures += "\n";
-                if (chain)
+                if (overloaded)
                     signatures += std::to_string(++index) + ". ";
-                signatures += rec->name;
-                signatures += it->signature;
+                signatures += chain_start->name;
+                signatures += signature_of(it);
                 signatures += "\n";
             }
-            if (it->doc && strlen(it->doc) > 0 && options::show_user_defined_docstrings()) {
+            if (it->doc && strlen(it->doc) > 0 && chain_start->show_docstrings) {
                 // If we're appending another docstring, and aren't printing function signatures, we
                 // need to append a newline first:
-                if (!options::show_function_signatures()) {
+                if (!chain_start->show_signatures) {
                     if (first_user_def) first_user_def = false;
                     else signatures += "\n";
                 }
-                if (options::show_function_signatures()) signatures += "\n";
+                if (chain_start->show_signatures) signatures += "\n";
                 signatures += it->doc;
-                if (options::show_function_signatures()) signatures += "\n";
+                if (chain_start->show_signatures) signatures += "\n";
             }
         }
 
-        /* Install docstring */
-        auto *func = (PyCFunctionObject *) m_ptr;
         std::free(const_cast<char *>(func->m_ml->ml_doc));
         // Install docstring if it's non-empty (when at least one option is enabled)
         func->m_ml->ml_doc = signatures.empty() ? nullptr : strdup(signatures.c_str());
+    }
 
-        if (rec->is_method) {
-            m_ptr = PYBIND11_INSTANCE_METHOD_NEW(m_ptr, rec->scope.ptr());
-            if (!m_ptr)
-                pybind11_fail("cpp_function::cpp_function(): Could not allocate instance method object");
-            Py_DECREF(func);
-        }
+    /// Installs the docstrings deferred while modules were initialized
+    static void install_pending_docstrings() {
+        auto functions = std::move(detail::get_pending_docstrings().functions);
+        detail::get_pending_docstrings().functions.clear();
+        for (auto &f : functions)
+            install_docstring((PyCFunctionObject *) f.ptr());
     }
 
     /// When a cpp_function is GCed, release any memory allocated by pybind11
@@ -514,6 +728,9 @@ protected:
                 std::free((char *) rec->name);
                 std::free((char *) rec->doc);
                 std::free((char *) rec->signature);
+#if defined(PYBIND11_DEFERRED_DOCSTRINGS) && defined(_MSC_VER)
+                std::free(const_cast<char *>(rec->signature_text));
+#endif
                 for (auto &arg: rec->args) {
                     std::free(const_cast<char *>(arg.name));
                     std::free(const_cast<char *>(arg.descr));
@@ -538,6 +755,15 @@ protected:
         }
     }
 
+    /// Like `signature_of`, for error messages (which must not raise another error)
+    static std::string signature_for_error(const detail::function_record *rec) {
+        try {
+            return signature_of(rec);
+        } catch (const error_already_set &) {
+            return "(...)";
+        }
+    }
+
     /// Main dispatch logic for calls to functions bound using pybind11
     static PyObject *dispatcher(PyObject *self, PyObject *args_in, PyObject *kwargs_in) {
         using namespace detail;
@@ -815,29 +1041,7 @@ protected:
             throw;
 #endif
         } catch (...) {
-            /* When an exception is caught, give each registered exception
-               translator a chance to translate it to a Python exception
-               in reverse order of registration.
-
-               A translator may choose to do one of the following:
-
-                - catch the exception and call PyErr_SetString or PyErr_SetObject
-                  to set a standard (or custom) Python exception, or
-                - do nothing and let the exception fall through to the next translator, or
-                - delegate translation to the next translator by throwing a new type of exception. */
-
-            auto last_exception = std::current_exception();
-            auto &registered_exception_translators = get_internals().registered_exception_translators;
-            for (auto& translator : registered_exception_translators) {
-                try {
-                    translator(last_exception);
-                } catch (...) {
-                    last_exception = std::current_exception();
-                    continue;
-                }
-                return nullptr;
-            }
-            PyErr_SetString(PyExc_SystemError, "Exception escaped from default exception translator!");
+            detail::translate_active_exception();
             return nullptr;
         }
 
@@ -866,7 +1070,7 @@ protected:
                 bool wrote_sig = false;
                 if (overloads->is_constructor) {
                     // For a constructor, rewrite `(self: Object, arg0, ...) -> NoneType` as `Object(arg0, ...)`
-                    std::string sig = it2->signature;
+                    std::string sig = signature_for_error(it2);
                     size_t start = sig.find('(') + 7; // skip "(self: "
                     if (start < sig.size()) {
                         // End at the , for the next argument
@@ -882,7 +1086,7 @@ protected:
                         }
                     }
                 }
-                if (!wrote_sig) msg += it2->signature;
+                if (!wrote_sig) msg += signature_for_error(it2);
 
                 msg += "\n";
             }
@@ -923,7 +1127,7 @@ protected:
         } else if (!result) {
             std::string msg = "Unable to convert function return value to a "
                               "Python type! The signature was\n\t";
-            msg += it->signature;
+            msg += signature_for_error(it);
             append_note_if_missing_header_is_suspected(msg);
             PyErr_SetString(PyExc_TypeError, msg.c_str());
             return nullptr;
@@ -937,6 +1141,47 @@ protected:
     }
 };
 
+class module_;
+
+PYBIND11_NAMESPACE_BEGIN(detail)
+/// A pending binding of `module_::def_lazy_class`, owned by the module. Once it is released
+/// (after the binding ran, or along with the module), the class is no longer bound lazily.
+struct lazy_binding {
+    std::type_index type;
+    PyObject *scope;
+    std::function<void(module_ &)> bind;
+
+    ~lazy_binding() {
+        auto &lazy_types = get_internals().lazy_types;
+        auto it = lazy_types.find(type);
+        if (it != lazy_types.end() && it->second.scope == scope)
+            lazy_types.erase(it);
+    }
+};
+
+/// Defers the docstrings of the functions bound during the initialization of a module (see
+/// `PYBIND11_MODULE`) to its end, unless `PYBIND11_EAGER_DOCSTRINGS` is defined
+class deferred_docstrings {
+public:
+    deferred_docstrings() { ++get_pending_docstrings().depth; }
+
+    ~deferred_docstrings() {
+        if (--get_pending_docstrings().depth > 0)
+            return;
+        error_scope scope; // Preserve the error of a failed initialization
+        try {
+            cpp_function::install_pending_docstrings();
+        } catch (error_already_set &e) {
+            e.discard_as_unraisable("pybind11::detail::deferred_docstrings");
+        } catch (...) {
+        }
+    }
+
+    deferred_docstrings(const deferred_docstrings &) = delete;
+    deferred_docstrings &operator=(const deferred_docstrings &) = delete;
+};
+PYBIND11_NAMESPACE_END(detail)
+
 /// Wrapper for Python extension modules
 class module_ : public object {
 public:
@@ -959,6 +1204,7 @@ public:
     \endrst */
     template <typename Func, typename... Extra>
     module_ &def(const char *name_, Func &&f, const Extra& ... extra) {
+        detail::import_profile_scope profile("function", *this, name_);
         cpp_function func(std::forward<Func>(f), name(name_), scope(*this),
                           sibling(getattr(*this, name_, none())), extra...);
         // NB: allow overwriting here because cpp_function sets up a chain with the intention of
@@ -987,6 +1233,29 @@ public:
         return result;
     }
 
+    /** \rst
+        Defers the binding of the C++ class ``type`` until the class is first accessed as an
+        attribute of the module, or first needed to cast a C++ object to Python. ``bind`` is called
+        with the module then, and must bind ``type`` with the given name:
+
+        .. code-block:: cpp
+
+            m.def_lazy_class<Pet>("Pet", [](py::module_ &m) {
+                py::class_<Pet>(m, "Pet").def(py::init<>());
+            });
+
+        Requires Python 3.7+ (see PEP 562); ``bind`` is called right away on older versions.
+    \endrst */
+    template <typename type, typename Func>
+    module_ &def_lazy_class(const char *name_, Func &&bind) {
+#if PY_VERSION_HEX >= 0x03070000
+        add_lazy_class(typeid(type), name_, std::function<void(module_ &)>(std::forward<Func>(bind)));
+#else
+        bind(*this);
+#endif
+        return *this;
+    }
+
     /// Import and return a module or throws `error_already_set`.
     static module_ import(const char *name) {
         PyObject *obj = PyImport_ImportModule(name);
@@ -1018,6 +1287,62 @@ public:
         PyModule_AddObject(ptr(), name, obj.inc_ref().ptr() /* steals a reference */);
     }
 
+#if PY_VERSION_HEX >= 0x03070000
+    /// Registers a class bound on first use (see `def_lazy_class`). The first one sets up the
+    /// module's `__getattr__` and `__dir__` (PEP 562), which look up the pending bindings in
+    /// `__pybind11_lazy_classes__`.
+    PYBIND11_NOINLINE void add_lazy_class(const std::type_info &tp, const char *name,
+                                          std::function<void(module_ &)> bind) {
+        auto &lazy_types = detail::get_internals().lazy_types;
+        if (detail::get_type_info(tp, false, false) || lazy_types.count(tp))
+            pybind11_fail("def_lazy_class: type \"" + std::string(name) + "\" is already registered!");
+        if (hasattr(*this, name))
+            pybind11_fail("Error during initialization: multiple incompatible definitions with name \"" +
+                    std::string(name) + "\"");
+
+        object pending = getattr(*this, "__pybind11_lazy_classes__", none());
+        if (pending.is_none()) {
+            pending = dict();
+            add_object("__pybind11_lazy_classes__", pending);
+            // Weak references: the module owns these functions
+            weakref module_ref(handle(*this));
+            add_object("__getattr__", cpp_function([module_ref](const pybind11::str &attr_name) -> object {
+                auto m = reinterpret_borrow<module_>(module_ref());
+                dict pending = m.attr("__pybind11_lazy_classes__");
+                if (pending.contains(attr_name)) {
+                    // The capsule removes the type from `lazy_types` when released, if the binding
+                    // fails (see `detail::lazy_binding`)
+                    auto binding = reinterpret_borrow<capsule>(pending[attr_name]);
+                    if (PyDict_DelItem(pending.ptr(), attr_name.ptr()) != 0)
+                        throw error_already_set();
+                    auto lazy = binding.get_pointer<detail::lazy_binding>();
+                    lazy->bind(m);
+                    if (!detail::get_type_info(lazy->type, false, false))
+                        pybind11_fail("def_lazy_class: the binding of \"" + std::string(attr_name) +
+                                      "\" did not bind its type!");
+                    return m.attr(attr_name);
+                }
+                PyErr_Format(PyExc_AttributeError, "module '%U' has no attribute '%U'",
+                             m.attr("__name__").ptr(), attr_name.ptr());
+                throw error_already_set();
+            }, pybind11::name("__getattr__")));
+            add_object("__dir__", cpp_function([module_ref]() {
+                auto m = reinterpret_borrow<module_>(module_ref());
+                list names(m.attr("__dict__"));
+                for (auto name : m.attr("__pybind11_lazy_classes__"))
+                    names.append(name);
+                return names;
+            }, pybind11::name("__dir__")), true /* overwrite: modules have a default __dir__ */);
+        }
+
+        auto binding = new detail::lazy_binding{tp, ptr(), std::move(bind)};
+        pending[pybind11::str(name)] = capsule(binding, [](void *ptr) {
+            delete static_cast<detail::lazy_binding *>(ptr);
+        });
+        lazy_types[tp] = detail::lazy_type{ptr(), name};
+    }
+#endif
+
 #if PY_MAJOR_VERSION >= 3
     using module_def = PyModuleDef;
 #else
@@ -1075,12 +1400,218 @@ inline dict globals() {
 }
 
 PYBIND11_NAMESPACE_BEGIN(detail)
+#if !defined(PYPY_VERSION)
+
+/// Descriptor used by `class_::def_member_descriptor` (and thereby `def_readwrite` and
+/// `def_readonly`) for arithmetic and string members. It converts the member directly, rather than
+/// going through a `property` of `cpp_function`s.
+struct member_descriptor {
+    PyObject_HEAD
+    const type_info *tinfo;   // bound class the member belongs to
+    char *name;               // member name (for error messages)
+    char *type_name;          // Python name of the member type (for error messages)
+    void *(*field)(void *value, const void *data);      // member address within the C++ value
+    PyObject *(*get)(const void *field);                // new reference, or null on error
+    bool (*set)(void *field, handle src);               // null for read-only members
+    void *data[2];            // storage for the member pointer
+    PyObject *fget, *fset;    // accessors like those of a `property` (null `fset` if read-only)
+};
+
+/// Whether `def_readwrite`/`def_readonly` bind a member (of type `D`, through a member pointer of
+/// type `PM`) with a member descriptor rather than a property
+template <typename PM, typename D, typename... Extra>
+using uses_member_descriptor = bool_constant<
+    sizeof...(Extra) == 0 && sizeof(PM) <= sizeof(member_descriptor::data) &&
+    (std::is_arithmetic<D>::value || std::is_same<D, std::string>::value)>;
+
+/// Returns the C++ value of `obj` for a member descriptor (or null, with a TypeError set)
+inline void *member_descriptor_value(member_descriptor *descr, PyObject *obj) {
+    if (Py_TYPE(obj) == descr->tinfo->type) {
+        auto inst = reinterpret_cast<instance *>(obj);
+        if (inst->simple_layout && inst->simple_value_holder[0])
+            return inst->simple_value_holder[0];
+    }
+    type_caster_generic caster(descr->tinfo);
+    if (caster.load(obj, false) && caster.value)
+        return caster.value;
+    PyErr_Format(PyExc_TypeError, "descriptor '%s' for '%s' objects doesn't apply to a '%s' object",
+                 descr->name, descr->tinfo->type->tp_name, Py_TYPE(obj)->tp_name);
+    return nullptr;
+}
+
+/// `member_descriptor.__get__()`
+extern "C" inline PyObject *pybind11_member_get(PyObject *self, PyObject *obj, PyObject *) {
+    auto descr = reinterpret_cast<member_descriptor *>(self);
+    if (!obj) {
+        Py_INCREF(self);
+        return self;
+    }
+    try {
+        void *value = member_descriptor_value(descr, obj);
+        return value ? descr->get(descr->field(value, descr->data)) : nullptr;
+    } catch (error_already_set &e) {
+        e.restore();
+        return nullptr;
+#ifdef __GLIBCXX__
+    } catch (abi::__forced_unwind &) {
+        throw;
+#endif
+    } catch (...) {
+        translate_active_exception();
+        return nullptr;
+    }
+}
+
+/// `member_descriptor.__set__()` and `__delete__()`
+extern "C" inline int pybind11_member_set(PyObject *self, PyObject *obj, PyObject *src) {
+    auto descr = reinterpret_cast<member_descriptor *>(self);
+    if (!src) {
+        PyErr_Format(PyExc_AttributeError, "can't delete attribute '%s'", descr->name);
+        return -1;
+    }
+    if (!descr->set) {
+        PyErr_Format(PyExc_AttributeError, "can't set attribute '%s'", descr->name);
+        return -1;
+    }
+    try {
+        void *value = member_descriptor_value(descr, obj);
+        if (!value)
+            return -1;
+        if (!descr->set(descr->field(value, descr->data), src)) {
+            PyErr_Format(PyExc_TypeError, "%s.%s: incompatible value of type '%s' (expected %s)",
+                         descr->tinfo->type->tp_name, descr->name, Py_TYPE(src)->tp_name,
+                         descr->type_name);
+            return -1;
+        }
+        return 0;
+    } catch (error_already_set &e) {
+        e.restore();
+        return -1;
+#ifdef __GLIBCXX__
+    } catch (abi::__forced_unwind &) {
+        throw;
+#endif
+    } catch (...) {
+        translate_active_exception();
+        return -1;
+    }
+}
+
+/// `member_descriptor.fget` and `fset`, for compatibility with `property` (`fset` is None for
+/// read-only members)
+extern "C" inline PyObject *pybind11_member_accessor(PyObject *self, void *closure) {
+    auto descr = reinterpret_cast<member_descriptor *>(self);
+    PyObject *accessor = closure ? descr->fset : descr->fget;
+    if (!accessor)
+        accessor = Py_None;
+    Py_INCREF(accessor);
+    return accessor;
+}
+
+/// `member_descriptor.__doc__`: the signature of the getter, as in the docstring of `fget`
+extern "C" inline PyObject *pybind11_member_doc(PyObject *self, void *) {
+    auto descr = reinterpret_cast<member_descriptor *>(self);
+    if (!descr->fget)
+        Py_RETURN_NONE;
+    return PyObject_GetAttrString(descr->fget, "__doc__");
+}
+
+/// The descriptor owns its `fget` and `fset`
+extern "C" inline int pybind11_member_traverse(PyObject *self, visitproc visit, void *arg) {
+    auto descr = reinterpret_cast<member_descriptor *>(self);
+    Py_VISIT(descr->fget);
+    Py_VISIT(descr->fset);
+    return 0;
+}
+
+extern "C" inline int pybind11_member_clear(PyObject *self) {
+    auto descr = reinterpret_cast<member_descriptor *>(self);
+    Py_CLEAR(descr->fget);
+    Py_CLEAR(descr->fset);
+    return 0;
+}
+
+extern "C" inline void pybind11_member_dealloc(PyObject *self) {
+    auto type = Py_TYPE(self);
+    PyObject_GC_UnTrack(self);
+    pybind11_member_clear(self);
+    std::free(reinterpret_cast<member_descriptor *>(self)->name);
+    std::free(reinterpret_cast<member_descriptor *>(self)->type_name);
+    type->tp_free(self);
+    Py_DECREF(type);
+}
+
+/** Create the type of the descriptors used by `class_::def_member_descriptor`.
+    Return value: New reference. */
+inline PyTypeObject *make_member_descriptor_type() {
+    constexpr auto *name = "pybind11_member";
+    auto name_obj = reinterpret_steal<object>(PYBIND11_FROM_STRING(name));
+
+    /* Danger zone: from now (and until PyType_Ready), make sure to
+       issue no Python C API calls which could potentially invoke the
+       garbage collector (the GC will call type_traverse(), which will in
+       turn find the newly constructed type in an invalid state) */
+    auto heap_type = (PyHeapTypeObject *) PyType_Type.tp_alloc(&PyType_Type, 0);
+    if (!heap_type)
+        pybind11_fail("make_member_descriptor_type(): error allocating type!");
+
+    heap_type->ht_name = name_obj.inc_ref().ptr();
+#ifdef PYBIND11_BUILTIN_QUALNAME
+    heap_type->ht_qualname = name_obj.inc_ref().ptr();
+#endif
+
+    auto type = &heap_type->ht_type;
+    type->tp_name = name;
+    type->tp_base = type_incref(&PyBaseObject_Type);
+    type->tp_basicsize = static_cast<ssize_t>(sizeof(member_descriptor));
+    type->tp_flags = Py_TPFLAGS_DEFAULT | Py_TPFLAGS_HEAPTYPE | Py_TPFLAGS_HAVE_GC;
+    type->tp_descr_get = pybind11_member_get;
+    type->tp_descr_set = pybind11_member_set;
+    type->tp_traverse = pybind11_member_traverse;
+    type->tp_clear = pybind11_member_clear;
+    type->tp_dealloc = pybind11_member_dealloc;
+
+    static char fset_closure;
+    static PyGetSetDef getset[] = {
+        {const_cast<char *>("fget"), pybind11_member_accessor, nullptr, nullptr, nullptr},
+        {const_cast<char *>("fset"), pybind11_member_accessor, nullptr, nullptr, &fset_closure},
+        {const_cast<char *>("__doc__"), pybind11_member_doc, nullptr, nullptr, nullptr},
+        {nullptr, nullptr, nullptr, nullptr, nullptr}
+    };
+    type->tp_getset = getset;
+
+    if (PyType_Ready(type) < 0)
+        pybind11_fail("make_member_descriptor_type(): failure in PyType_Ready()!");
+
+    setattr((PyObject *) type, "__module__", str("pybind11_builtins"));
+    PYBIND11_SET_OLDPY_QUALNAME(type, name_obj);
+
+    return type;
+}
+
+/// Returns the (lazily created) member descriptor type
+inline PyTypeObject *get_member_descriptor_type() {
+    auto &internals = get_internals();
+    if (!internals.member_descriptor_type)
+        internals.member_descriptor_type = make_member_descriptor_type();
+    return internals.member_descriptor_type;
+}
+
+#else
+
+template <typename PM, typename D, typename... Extra>
+using uses_member_descriptor = std::false_type;
+
+#endif // PYPY
+
 /// Generic support for creating new Python heap types
 class generic_type : public object {
 public:
     PYBIND11_OBJECT_DEFAULT(generic_type, object, PyType_Check)
 protected:
     void initialize(const type_record &rec) {
+        import_profile_scope profile("class", rec.scope, rec.name);
+
         if (rec.scope && hasattr(rec.scope, "__dict__") && rec.scope.attr("__dict__").contains(rec.name))
             pybind11_fail("generic_type: cannot initialize type \"" + std::string(rec.name) +
                           "\": an object with that name is already defined");
@@ -1089,6 +1620,18 @@ protected:
             pybind11_fail("generic_type: type \"" + std::string(rec.name) +
                           "\" is already registered!");
 
+        if (rec.inline_storage && !rec.default_holder)
+            pybind11_fail("generic_type: type \"" + std::string(rec.name) +
+                          "\" uses py::inline_storage(), which requires the default holder type");
+
+        if (rec.free_list_size && rec.dynamic_attr)
+            pybind11_fail("generic_type: type \"" + std::string(rec.name) +
+                          "\" cannot combine py::free_list() with py::dynamic_attr()");
+
+        if (rec.inline_storage && rec.type_align > alignof(std::max_align_t))
+            pybind11_fail("generic_type: type \"" + std::string(rec.name) +
+                          "\" is over-aligned and cannot use py::inline_storage()");
+
         m_ptr = make_new_python_type(rec);
 
         /* Register supplemental type information in C++ dict */
@@ -1105,6 +1648,20 @@ protected:
         tinfo->simple_ancestors = true;
         tinfo->default_holder = rec.default_holder;
         tinfo->module_local = rec.module_local;
+        tinfo->inline_offset = inline_storage_offset(rec);
+        tinfo->inline_copy = rec.inline_copy;
+        tinfo->inline_move = rec.inline_move;
+#if !defined(PYPY_VERSION)
+        if (rec.free_list_size) {
+            auto *free_list = tinfo->free_list = new instance_free_list();
+            free_list->max_size = rec.free_list_size;
+            // Release the cached memory while the interpreter is still fully functional
+            module_::import("atexit").attr("register")(cpp_function([free_list]() {
+                free_list->max_size = 0;
+                clear_free_list(free_list);
+            }));
+        }
+#endif
 
         auto &internals = get_internals();
         auto tindex = std::type_index(*rec.type);
@@ -1114,6 +1671,9 @@ protected:
         else
             internals.registered_types_cpp[tindex] = tinfo;
         internals.registered_types_py[(PyTypeObject *) m_ptr] = { tinfo };
+        ++internals.type_registry_generation;
+
+        internals.lazy_types.erase(tindex);
 
         if (rec.bases.size() > 1 || rec.multiple_inheritance) {
             mark_parents_nonsimple(tinfo->type);
@@ -1186,6 +1746,30 @@ template <typename T> struct has_operator_delete<T, void_t<decltype(static_cast<
 template <typename T, typename SFINAE = void> struct has_operator_delete_size : std::false_type { };
 template <typename T> struct has_operator_delete_size<T, void_t<decltype(static_cast<void (*)(void *, size_t)>(T::operator delete))>>
     : std::true_type { };
+/// py::inline_storage: copy/move constructs a value in place, if the type allows it
+template <typename T, enable_if_t<is_copy_constructible<T>::value, int> = 0>
+void set_inline_copy(type_record *r) {
+    r->inline_copy = [](void *dst, const void *src) {
+        ::new (dst) T(*reinterpret_cast<const T *>(src));
+    };
+}
+template <typename T, enable_if_t<!is_copy_constructible<T>::value, int> = 0>
+void set_inline_copy(type_record *) { }
+
+template <typename T, enable_if_t<std::is_move_constructible<T>::value, int> = 0>
+void set_inline_move(type_record *r) {
+    r->inline_move = [](void *dst, void *src) {
+        ::new (dst) T(std::move(*reinterpret_cast<T *>(src)));
+    };
+}
+template <typename T, enable_if_t<!std::is_move_constructible<T>::value, int> = 0>
+void set_inline_move(type_record *) { }
+
+template <typename T> void set_inline_copy_move(type_record *r) {
+    set_inline_copy<T>(r);
+    set_inline_move<T>(r);
+}
+
 /// Call class-specific delete if it exists or global otherwise. Can also be an overload set.
 template <typename T, enable_if_t<has_operator_delete<T>::value, int> = 0>
 void call_operator_delete(T *p, size_t, size_t) { T::operator delete(p); }
@@ -1286,6 +1870,7 @@ public:
         record.default_holder = detail::is_instantiation<std::unique_ptr, holder_type>::value;
 
         set_operator_new<type>(&record);
+        set_inline_copy_move<type>(&record);
 
         /* Register base classes specified via template arguments to class_, if any */
         PYBIND11_EXPAND_SIDE_EFFECTS(add_base<options>(record));
@@ -1293,11 +1878,16 @@ public:
         /* Process optional arguments, if any */
         process_attributes<Extra...>::init(extra..., &record);
 
+        if (record.inline_storage && !std::is_destructible<type>::value)
+            pybind11_fail("generic_type: type \"" + std::string(name) +
+                          "\" has a non-public destructor and cannot use py::inline_storage()");
+
         generic_type::initialize(record);
 
         if (has_alias) {
             auto &instances = record.module_local ? registered_local_types_cpp() : get_internals().registered_types_cpp;
             instances[std::type_index(typeid(type_alias))] = instances[std::type_index(typeid(type))];
+            ++get_internals().type_registry_generation;
         }
     }
 
@@ -1313,6 +1903,7 @@ public:
 
     template <typename Func, typename... Extra>
     class_ &def(const char *name_, Func&& f, const Extra&... extra) {
+        detail::import_profile_scope profile("method", *this, name_);
         cpp_function cf(method_adaptor<type>(std::forward<Func>(f)), name(name_), is_method(*this),
                         sibling(getattr(*this, name_, none())), extra...);
         add_class_method(*this, name_, cf);
@@ -1323,6 +1914,7 @@ public:
     def_static(const char *name_, Func &&f, const Extra&... extra) {
         static_assert(!std::is_member_function_pointer<Func>::value,
                 "def_static(...) called with a non-static member function pointer");
+        detail::import_profile_scope profile("method", *this, name_);
         cpp_function cf(std::forward<Func>(f), name(name_), scope(*this),
                         sibling(getattr(*this, name_, none())), extra...);
         attr(cf.name()) = staticmethod(cf);
@@ -1392,20 +1984,66 @@ public:
         return def_buffer([func] (const type &obj) { return (obj.*func)(); });
     }
 
+    /// Binds a member through a property of a getter and a setter; arithmetic and string members
+    /// without extra attributes use `def_member_descriptor` instead
     template <typename C, typename D, typename... Extra>
     class_ &def_readwrite(const char *name, D C::*pm, const Extra&... extra) {
         static_assert(std::is_same<C, type>::value || std::is_base_of<C, type>::value, "def_readwrite() requires a class member (or base class member)");
-        cpp_function fget([pm](const type &c) -> const D &{ return c.*pm; }, is_method(*this)),
-                     fset([pm](type &c, const D &value) { c.*pm = value; }, is_method(*this));
-        def_property(name, fget, fset, return_value_policy::reference_internal, extra...);
-        return *this;
+        return def_readwrite_impl(name, pm, detail::uses_member_descriptor<D C::*, D, Extra...>{}, extra...);
     }
 
+    /// Binds a member through a read-only property; arithmetic and string members without extra
+    /// attributes use `def_member_descriptor` instead
     template <typename C, typename D, typename... Extra>
     class_ &def_readonly(const char *name, const D C::*pm, const Extra& ...extra) {
         static_assert(std::is_same<C, type>::value || std::is_base_of<C, type>::value, "def_readonly() requires a class member (or base class member)");
-        cpp_function fget([pm](const type &c) -> const D &{ return c.*pm; }, is_method(*this));
-        def_property_readonly(name, fget, return_value_policy::reference_internal, extra...);
+        return def_readonly_impl(name, pm, detail::uses_member_descriptor<const D C::*, D, Extra...>{}, extra...);
+    }
+
+    /** \rst
+        Binds an arithmetic or ``std::string`` member like ``def_readwrite`` (or ``def_readonly``
+        if ``readonly`` is true or the member is ``const``), through a descriptor that converts the
+        member directly instead of a ``property`` of functions. This makes attribute access
+        considerably faster. The descriptor is not a ``property``, but provides the same ``fget``
+        and ``fset`` functions, and the docstring of ``fget``. On PyPy, this binds a property.
+    \endrst */
+    template <typename C, typename D>
+    class_ &def_member_descriptor(const char *name, D C::*pm, bool readonly = false) {
+        static_assert(std::is_same<C, type>::value || std::is_base_of<C, type>::value, "def_member_descriptor() requires a class member (or base class member)");
+        using T = typename std::remove_const<D>::type;
+        static_assert(std::is_arithmetic<T>::value || std::is_same<T, std::string>::value,
+                      "def_member_descriptor() requires an arithmetic or std::string member");
+#if !defined(PYPY_VERSION)
+        static_assert(sizeof(pm) <= sizeof(detail::member_descriptor::data),
+                      "member pointer does not fit into a member descriptor");
+        auto descr = reinterpret_steal<object>(PyType_GenericAlloc(detail::get_member_descriptor_type(), 0));
+        if (!descr)
+            throw error_already_set();
+        using PM = D C::*;
+        PYBIND11_DESCR_CONSTEXPR auto type_name = detail::make_caster<T>::name;
+        auto rec = reinterpret_cast<detail::member_descriptor *>(descr.ptr());
+        rec->tinfo = detail::get_type_info(typeid(type));
+        rec->name = strdup(name);
+        rec->type_name = strdup(type_name.text);
+        new (rec->data) PM(pm);
+        rec->field = [](void *value, const void *data) -> void * {
+            const PM &pm = *reinterpret_cast<const PM *>(data);
+            return const_cast<void *>(static_cast<const void *>(&(static_cast<type *>(value)->*pm)));
+        };
+        rec->get = [](const void *field) -> PyObject * {
+            return detail::make_caster<T>::cast(*reinterpret_cast<const T *>(field),
+                                                return_value_policy::copy, handle()).ptr();
+        };
+        rec->fget = cpp_function([pm](const type &c) -> const D & { return c.*pm; },
+                                 is_method(*this)).release().ptr();
+        if (!readonly) {
+            rec->set = member_setter<D>(std::is_const<D>{});
+            rec->fset = member_fset(pm, std::is_const<D>{}).release().ptr();
+        }
+        attr(name) = descr;
+#else
+        def_member_fallback(name, pm, readonly, std::is_const<D>{});
+#endif
         return *this;
     }
 
@@ -1501,6 +2139,70 @@ public:
     }
 
 private:
+    template <typename C, typename D, typename... Extra>
+    class_ &def_readwrite_impl(const char *name, D C::*pm, std::false_type, const Extra&... extra) {
+        cpp_function fget([pm](const type &c) -> const D &{ return c.*pm; }, is_method(*this)),
+                     fset([pm](type &c, const D &value) { c.*pm = value; }, is_method(*this));
+        def_property(name, fget, fset, return_value_policy::reference_internal, extra...);
+        return *this;
+    }
+
+    template <typename C, typename D>
+    class_ &def_readwrite_impl(const char *name, D C::*pm, std::true_type) {
+        return def_member_descriptor(name, pm);
+    }
+
+    template <typename C, typename D, typename... Extra>
+    class_ &def_readonly_impl(const char *name, const D C::*pm, std::false_type, const Extra& ...extra) {
+        cpp_function fget([pm](const type &c) -> const D &{ return c.*pm; }, is_method(*this));
+        def_property_readonly(name, fget, return_value_policy::reference_internal, extra...);
+        return *this;
+    }
+
+    template <typename C, typename D>
+    class_ &def_readonly_impl(const char *name, const D C::*pm, std::true_type) {
+        return def_member_descriptor(name, pm, true);
+    }
+
+#if !defined(PYPY_VERSION)
+    /// The `fset` of a member bound by `def_member_descriptor`
+    template <typename C, typename D>
+    object member_fset(D C::*pm, std::false_type) {
+        return cpp_function([pm](type &c, const D &value) { c.*pm = value; }, is_method(*this));
+    }
+
+    template <typename C, typename D>
+    object member_fset(D C::*, std::true_type) { return object(); }
+
+    /// Conversion of a Python value to a member bound by `def_member_descriptor`
+    template <typename D>
+    static bool (*member_setter(std::false_type))(void *, handle) {
+        return [](void *field, handle src) {
+            detail::make_caster<D> conv;
+            if (!conv.load(src, true))
+                return false;
+            *reinterpret_cast<D *>(field) = detail::cast_op<D>(std::move(conv));
+            return true;
+        };
+    }
+
+    template <typename D>
+    static bool (*member_setter(std::true_type))(void *, handle) { return nullptr; }
+#else
+    template <typename C, typename D>
+    void def_member_fallback(const char *name, D C::*pm, bool readonly, std::false_type) {
+        if (readonly)
+            def_readonly(name, pm);
+        else
+            def_readwrite(name, pm);
+    }
+
+    template <typename C, typename D>
+    void def_member_fallback(const char *name, D C::*pm, bool, std::true_type) {
+        def_readonly(name, pm);
+    }
+#endif
+
     /// Initialize holder object, variant 1: object derives from enable_shared_from_this
     template <typename T>
     static void init_holder(detail::instance *inst, detail::value_and_holder &v_h,
@@ -1552,10 +2254,20 @@ private:
             register_instance(inst, v_h.value_ptr(), v_h.type);
             v_h.set_instance_registered();
         }
+        if (v_h.value_is_inline()) { // py::inline_storage(): the instance owns the value directly
+            v_h.set_holder_constructed();
+            return;
+        }
         init_holder(inst, v_h, (const holder_type *) holder_ptr, v_h.value_ptr<type>());
     }
 
-    /// Deallocates an instance; via holder, if constructed; otherwise via operator delete.
+    template <typename T = type, detail::enable_if_t<std::is_destructible<T>::value, int> = 0>
+    static void destroy_inline(T *value) { value->~T(); }
+    template <typename T = type, detail::enable_if_t<!std::is_destructible<T>::value, int> = 0>
+    static void destroy_inline(T *) { }
+
+    /// Deallocates an instance; via holder, if constructed; otherwise via operator delete.  Values
+    /// stored inline (py::inline_storage) are destroyed in place.
     static void dealloc(detail::value_and_holder &v_h) {
         // We could be deallocating because we are cleaning up after a Python exception.
         // If so, the Python error indicator will be set. We need to clear that before
@@ -1564,7 +2276,13 @@ private:
         // throw error_already_set from the C++ destructor which is forbidden and triggers
         // std::terminate().
         error_scope scope;
-        if (v_h.holder_constructed()) {
+        if (v_h.value_is_inline()) {
+            if (v_h.holder_constructed()) {
+                destroy_inline(v_h.value_ptr<type>());
+                v_h.set_holder_constructed(false);
+            }
+        }
+        else if (v_h.holder_constructed()) {
             v_h.holder<holder_type>().~holder_type();
             v_h.set_holder_constructed(false);
         }
@@ -1584,6 +2302,46 @@ private:
     }
 };
 
+/// Usage statistics of the instance free list of a type bound with py::free_list()
+struct free_list_stats {
+    size_t size = 0;      ///< Number of instances currently kept for reuse
+    size_t max_size = 0;  ///< Maximum number of instances kept for reuse
+    size_t reused = 0;    ///< Number of instances allocated from the free list
+    size_t allocated = 0; ///< Number of instances that needed a new allocation
+};
+
+/// Returns the free list statistics of a bound type (all zero if it doesn't use py::free_list())
+inline free_list_stats get_free_list_stats(handle type) {
+    free_list_stats stats;
+    auto tinfo = detail::get_type_info((PyTypeObject *) type.ptr());
+    if (tinfo && tinfo->type == (PyTypeObject *) type.ptr() && tinfo->free_list) {
+        stats.size = tinfo->free_list->blocks.size();
+        stats.max_size = tinfo->free_list->max_size;
+        stats.reused = tinfo->free_list->reused;
+        stats.allocated = tinfo->free_list->allocated;
+    }
+    return stats;
+}
+
+/// Counters of the implicit conversions (see implicitly_convertible()) to a bound type
+struct implicit_conversion_stats {
+    size_t attempts = 0;  ///< Number of conversions that were tried
+    size_t succeeded = 0; ///< Number of conversions that produced a value
+    size_t skipped = 0;   ///< Number of conversions skipped as they can't apply to the source type
+};
+
+/// Returns the implicit conversion counters of a bound type (all zero for other types)
+inline implicit_conversion_stats get_implicit_conversion_stats(handle type) {
+    implicit_conversion_stats stats;
+    auto tinfo = detail::get_type_info((PyTypeObject *) type.ptr());
+    if (tinfo && tinfo->type == (PyTypeObject *) type.ptr()) {
+        stats.attempts = tinfo->implicit_conversion_attempts;
+        stats.succeeded = tinfo->implicit_conversion_successes;
+        stats.skipped = tinfo->implicit_conversion_skips;
+    }
+    return stats;
+}
+
 /// Binds an existing constructor taking arguments Args...
 template <typename... Args> detail::initimpl::constructor<Args...> init() { return {}; }
 /// Like `init<Args...>()`, but the instance is always constructed through the alias class (even
@@ -1611,7 +2369,8 @@ detail::initimpl::pickle_factory<GetState, SetState> pickle(GetState &&g, SetSta
 PYBIND11_NAMESPACE_BEGIN(detail)
 
 inline str enum_name(handle arg) {
-    dict entries = arg.get_type().attr("__entries");
+    static const interned_str entries_key("__entries");
+    dict entries = arg.get_type().attr(entries_key);
     for (auto kv : entries) {
         if (handle(kv.second[int_(0)]).equal(arg))
             return pybind11::str(kv.first);
@@ -1629,8 +2388,9 @@ struct enum_base {
 
         m_base.attr("__repr__") = cpp_function(
             [](object arg) -> str {
+                static const interned_str name_key("__name__");
                 handle type = type::handle_of(arg);
-                object type_name = type.attr("__name__");
+                object type_name = type.attr(name_key);
                 return pybind11::str("<{}.{}: {}>").format(type_name, enum_name(arg), int_(arg));
             }, name("__repr__"), is_method(m_base)
         );
@@ -1639,7 +2399,8 @@ struct enum_base {
 
         m_base.attr("__str__") = cpp_function(
             [](handle arg) -> str {
-                object type_name = type::handle_of(arg).attr("__name__");
+                static const interned_str name_key("__name__");
+                object type_name = type::handle_of(arg).attr(name_key);
                 return pybind11::str("{}.{}").format(type_name, enum_name(arg));
             }, name("name"), is_method(m_base)
         );
@@ -1664,7 +2425,8 @@ struct enum_base {
 
         m_base.attr("__members__") = static_property(cpp_function(
             [](handle arg) -> dict {
-                dict entries = arg.attr("__entries"), m;
+                static const interned_str entries_key("__entries");
+                dict entries = arg.attr(entries_key), m;
                 for (auto kv : entries)
                     m[kv.first] = kv.second[int_(0)];
                 return m;
@@ -1869,7 +2631,9 @@ inline std::pair<decltype(internals::registered_types_py)::iterator, bool> all_t
         // New cache entry created; set up a weak reference to automatically remove it if the type
         // gets destroyed:
         weakref((PyObject *) type, cpp_function([type](handle wr) {
-            get_internals().registered_types_py.erase(type);
+            auto &internals = get_internals();
+            internals.registered_types_py.erase(type);
+            ++internals.type_registry_generation;
             wr.dec_ref();
         })).release();
     }
@@ -1978,10 +2742,35 @@ template <typename InputType, typename OutputType> void implicitly_convertible()
         return result;
     };
 
-    if (auto tinfo = detail::get_type_info(typeid(OutputType)))
+    if (auto tinfo = detail::get_type_info(typeid(OutputType))) {
         tinfo->implicit_conversions.push_back(implicit_caster);
-    else
+        // Conversions registered without a filter may apply to any type
+        bool (*may_apply)(PyTypeObject *) = [](PyTypeObject *) { return true; };
+        tinfo->implicit_conversion_filters.resize(tinfo->implicit_conversions.size() - 1, may_apply);
+        tinfo->implicit_conversion_filters.push_back(&detail::type_load_filter<InputType>::may_load);
+        tinfo->implicit_conversions_skipped.clear();
+    } else
+        pybind11_fail("implicitly_convertible: Unable to find type " + type_id<OutputType>());
+}
+
+/// Tag for implicitly_convertible() which converts between two bound types with the C++
+/// constructor `OutputType(const InputType &)` rather than by calling the Python type
+struct cpp_conversion {};
+
+template <typename InputType, typename OutputType> void implicitly_convertible(cpp_conversion) {
+    static_assert(std::is_constructible<OutputType, const InputType &>::value,
+                  "implicitly_convertible(py::cpp_conversion()): OutputType must be constructible "
+                  "from const InputType &");
+    auto tinfo = detail::get_type_info(typeid(OutputType));
+    if (!tinfo)
         pybind11_fail("implicitly_convertible: Unable to find type " + type_id<OutputType>());
+    if (!detail::get_type_info(typeid(InputType)))
+        pybind11_fail("implicitly_convertible: Unable to find type " + type_id<InputType>());
+
+    tinfo->cpp_conversions.emplace_back(&typeid(InputType), [](const void *src) -> void * {
+        return new OutputType(*static_cast<const InputType *>(src));
+    });
+    tinfo->cpp_conversion_destroy = [](void *value) { delete static_cast<OutputType *>(value); };
 }
 
 template <typename ExceptionTranslator>
@@ -2110,11 +2899,118 @@ void print(Args &&...args) {
  * example which uses features 2 and 3 to migrate the Python thread of
  * execution to another thread (to run the event loop on the original thread,
  * in this case).
+ *
+ * 4. gil_scoped_acquire::persist() keeps the thread state of a non-Python
+ *    thread alive until that thread exits, so that worker threads which
+ *    repeatedly call into Python don't create and destroy one every time.
  */
 
+PYBIND11_NAMESPACE_BEGIN(detail)
+
+/// Incremented when the interpreter starts finalizing (from an `atexit` hook). Thread states
+/// persisted under an older generation are destroyed by Py_Finalize() and must not be touched.
+inline std::atomic<size_t> &thread_state_generation() {
+    static std::atomic<size_t> generation{0};
+    return generation;
+}
+
+/// Thread-local owner of the extra reference taken by gil_scoped_acquire::persist(); it is
+/// released (deleting the thread state) when the OS thread exits.
+struct persistent_thread_state {
+    PyThreadState *created = nullptr; // thread state created by gil_scoped_acquire, if any
+    PyThreadState *tstate = nullptr;  // persisted thread state
+    size_t generation = 0;
+
+    ~persistent_thread_state() {
+        if (!tstate || generation != thread_state_generation() || !Py_IsInitialized())
+            return;
+        PyEval_AcquireThread(tstate);
+        if (--tstate->gilstate_counter == 0) {
+            created = nullptr;
+            PYBIND11_TLS_DELETE_VALUE(get_internals().tstate);
+            PyThreadState_Clear(tstate);
+            PyThreadState_DeleteCurrent();
+        } else {
+            PyEval_ReleaseThread(tstate);
+        }
+    }
+};
+
+inline persistent_thread_state &this_thread_persistent_state() {
+    static thread_local persistent_thread_state state;
+    return state;
+}
+
+PYBIND11_NAMESPACE_END(detail)
+
 class gil_scoped_acquire {
 public:
-    PYBIND11_NOINLINE gil_scoped_acquire() {
+    gil_scoped_acquire() {
+        /* Fast path for nested acquisitions: if the thread state bound to this thread is the
+           one currently holding the GIL, there is nothing to acquire. This needs a single TLS
+           lookup and doesn't touch the internals. */
+        tstate = detail::get_thread_state_unchecked();
+        if (tstate && tstate == PyGILState_GetThisThreadState()) {
+            release = false;
+            inc_ref();
+            return;
+        }
+        acquire();
+    }
+
+    void inc_ref() {
+        ++tstate->gilstate_counter;
+    }
+
+    void dec_ref() {
+        --tstate->gilstate_counter;
+        #if !defined(NDEBUG)
+            if (detail::get_thread_state_unchecked() != tstate)
+                pybind11_fail("scoped_acquire::dec_ref(): thread state must be current!");
+            if (tstate->gilstate_counter < 0)
+                pybind11_fail("scoped_acquire::dec_ref(): reference count underflow!");
+        #endif
+        if (tstate->gilstate_counter == 0)
+            delete_thread_state();
+    }
+
+    /// Keep the thread state of the calling thread alive until the OS thread exits, rather
+    /// than destroying it when the last gil_scoped_acquire goes out of scope. Intended for
+    /// long-lived worker threads that repeatedly call into Python. Has no effect on threads
+    /// whose thread state is owned by Python. Persisted thread states are discarded when the
+    /// interpreter is finalized; threads must not exit concurrently with finalization.
+    PYBIND11_NOINLINE void persist() {
+        auto &state = detail::this_thread_persistent_state();
+        auto &generation = detail::thread_state_generation();
+        if (state.created != tstate || (state.tstate == tstate && state.generation == generation))
+            return;
+        static size_t hooked_generation = (size_t) -1;
+        if (hooked_generation != generation) {
+            module_::import("atexit").attr("register")(
+                cpp_function([]() { ++detail::thread_state_generation(); }));
+            hooked_generation = generation;
+        }
+        state.tstate = tstate;
+        state.generation = generation;
+        inc_ref();
+    }
+
+    /// This method will disable the PyThreadState_DeleteCurrent call and the
+    /// GIL won't be acquired. This method should be used if the interpreter
+    /// could be shutting down when this is called, as thread deletion is not
+    /// allowed during shutdown. Check _Py_IsFinalizing() on Python 3.7+, and
+    /// protect subsequent code.
+    PYBIND11_NOINLINE void disarm() {
+        active = false;
+    }
+
+    ~gil_scoped_acquire() {
+        dec_ref();
+        if (release)
+           PyEval_SaveThread();
+    }
+private:
+    PYBIND11_NOINLINE void acquire() {
         auto const &internals = detail::get_internals();
         tstate = (PyThreadState *) PYBIND11_TLS_GET_VALUE(internals.tstate);
 
@@ -2135,6 +3031,7 @@ public:
             #endif
             tstate->gilstate_counter = 0;
             PYBIND11_TLS_REPLACE_VALUE(internals.tstate, tstate);
+            detail::this_thread_persistent_state().created = tstate;
         } else {
             release = detail::get_thread_state_unchecked() != tstate;
         }
@@ -2146,46 +3043,19 @@ public:
         inc_ref();
     }
 
-    void inc_ref() {
-        ++tstate->gilstate_counter;
-    }
-
-    PYBIND11_NOINLINE void dec_ref() {
-        --tstate->gilstate_counter;
+    PYBIND11_NOINLINE void delete_thread_state() {
         #if !defined(NDEBUG)
-            if (detail::get_thread_state_unchecked() != tstate)
-                pybind11_fail("scoped_acquire::dec_ref(): thread state must be current!");
-            if (tstate->gilstate_counter < 0)
-                pybind11_fail("scoped_acquire::dec_ref(): reference count underflow!");
+            if (!release)
+                pybind11_fail("scoped_acquire::dec_ref(): internal error!");
         #endif
-        if (tstate->gilstate_counter == 0) {
-            #if !defined(NDEBUG)
-                if (!release)
-                    pybind11_fail("scoped_acquire::dec_ref(): internal error!");
-            #endif
-            PyThreadState_Clear(tstate);
-            if (active)
-                PyThreadState_DeleteCurrent();
-            PYBIND11_TLS_DELETE_VALUE(detail::get_internals().tstate);
-            release = false;
-        }
-    }
-
-    /// This method will disable the PyThreadState_DeleteCurrent call and the
-    /// GIL won't be acquired. This method should be used if the interpreter
-    /// could be shutting down when this is called, as thread deletion is not
-    /// allowed during shutdown. Check _Py_IsFinalizing() on Python 3.7+, and
-    /// protect subsequent code.
-    PYBIND11_NOINLINE void disarm() {
-        active = false;
+        PyThreadState_Clear(tstate);
+        if (active)
+            PyThreadState_DeleteCurrent();
+        PYBIND11_TLS_DELETE_VALUE(detail::get_internals().tstate);
+        detail::this_thread_persistent_state().created = nullptr;
+        release = false;
     }
 
-    PYBIND11_NOINLINE ~gil_scoped_acquire() {
-        dec_ref();
-        if (release)
-           PyEval_SaveThread();
-    }
-private:
     PyThreadState *tstate = nullptr;
     bool release = true;
     bool active = true;
@@ -2236,6 +3106,7 @@ class gil_scoped_acquire {
 public:
     gil_scoped_acquire() { state = PyGILState_Ensure(); }
     ~gil_scoped_acquire() { PyGILState_Release(state); }
+    void persist() {}
     void disarm() {}
 };
 
@@ -2248,6 +3119,7 @@ public:
 };
 #else
 class gil_scoped_acquire {
+    void persist() {}
     void disarm() {}
 };
 class gil_scoped_release {
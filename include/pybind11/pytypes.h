@@ -25,6 +25,7 @@ struct arg; struct arg_v;
 PYBIND11_NAMESPACE_BEGIN(detail)
 class args_proxy;
 inline bool isinstance_generic(handle obj, const std::type_info &tp);
+inline size_t internals_id();
 
 // Accessor forward declarations
 template <typename Policy> class accessor;
@@ -370,6 +371,53 @@ private:
     object m_type, m_value, m_trace;
 };
 
+/** \rst
+    A Python string which is created and interned on first use, then reused for the rest of
+    the process. Declare it ``static`` and pass it to ``attr()``, ``getattr()``, ``hasattr()``
+    etc. in hot code paths to avoid building and hashing a fresh string on every lookup:
+
+    .. code-block:: cpp
+
+        static const py::interned_str entries_key("__entries");
+        dict entries = type.attr(entries_key);
+
+    The GIL must be held whenever the string is accessed. The reference is intentionally
+    never released, so that function-local statics remain valid during interpreter shutdown.
+    After an embedded interpreter is restarted (see ``finalize_interpreter()``), the string
+    is created again, as the old one belonged to the finalized interpreter.
+\endrst */
+class interned_str {
+public:
+    constexpr explicit interned_str(const char *value) : m_value(value), m_ptr(nullptr), m_internals_id(0) { }
+
+    /// Return the interned string (borrowed reference), creating it if necessary
+    handle get() const {
+        // Not cached until the internals exist, as it couldn't be told apart from a string created
+        // before a restart
+        auto internals_id = detail::internals_id();
+        if (!m_ptr || m_internals_id != internals_id || internals_id == 0) {
+#if PY_MAJOR_VERSION >= 3
+            m_ptr = PyUnicode_InternFromString(m_value);
+#else
+            m_ptr = PyString_InternFromString(m_value);
+#endif
+            if (!m_ptr)
+                throw error_already_set();
+            m_internals_id = internals_id;
+        }
+        return m_ptr;
+    }
+
+    operator handle() const { return get(); }
+
+    const char *c_str() const { return m_value; }
+
+private:
+    const char *m_value;
+    mutable PyObject *m_ptr;
+    mutable size_t m_internals_id; // `internals::id` of the interpreter that `m_ptr` belongs to
+};
+
 /** \defgroup python_builtins _
     Unless stated otherwise, the following C++ functions behave the same
     as their Python counterparts.
@@ -779,7 +827,7 @@ template <typename T> using is_positional = satisfies_none_of<T,
 template <typename T> using is_keyword_or_ds = satisfies_any_of<T, is_keyword, is_ds_unpacking>;
 
 // Call argument collector forward declarations
-template <return_value_policy policy = return_value_policy::automatic_reference>
+template <return_value_policy policy, size_t N>
 class simple_collector;
 template <return_value_policy policy = return_value_policy::automatic_reference>
 class unpacking_collector;
@@ -973,7 +1021,8 @@ public:
 
     template <typename... Args>
     str format(Args &&...args) const {
-        return attr("format")(std::forward<Args>(args)...);
+        static const interned_str format_key("format");
+        return attr(format_key)(std::forward<Args>(args)...);
     }
 
 private:
@@ -1535,6 +1584,117 @@ inline memoryview memoryview::from_buffer(
     return memoryview(object(obj, stolen_t{}));
 }
 #endif  // DOXYGEN_SHOULD_SKIP_THIS
+
+#if PY_VERSION_HEX >= 0x03080000 && !defined(PYPY_VERSION)
+#  define PYBIND11_HAS_PICKLE_BUFFER
+
+PYBIND11_NAMESPACE_BEGIN(detail)
+/// Exposes the memory described by a `buffer_info` through the buffer protocol, keeping the
+/// object which owns the memory alive (see `pickle_buffer`)
+struct buffer_exporter {
+    PyObject_HEAD
+    buffer_info *info;
+    PyObject *owner;
+
+    static PyTypeObject *type() {
+        static PyTypeObject *type = [] {
+            static PyBufferProcs buffer_procs = {getbuffer, nullptr};
+            static PyTypeObject type_object;
+            auto t = &type_object;
+            ((PyObject *) t)->ob_refcnt = 1;
+            ((PyObject *) t)->ob_type = &PyType_Type;
+            t->tp_name = "pybind11_buffer_exporter";
+            t->tp_basicsize = sizeof(buffer_exporter);
+            t->tp_flags = Py_TPFLAGS_DEFAULT;
+            t->tp_dealloc = dealloc;
+            t->tp_as_buffer = &buffer_procs;
+            if (PyType_Ready(t) < 0)
+                pybind11_fail("buffer_exporter::type(): failure in PyType_Ready()!");
+            return t;
+        }();
+        return type;
+    }
+
+    static int getbuffer(PyObject *obj, Py_buffer *view, int flags) {
+        auto info = ((buffer_exporter *) obj)->info;
+        std::memset(view, 0, sizeof(Py_buffer));
+        if ((flags & PyBUF_WRITABLE) == PyBUF_WRITABLE && info->readonly) {
+            PyErr_SetString(PyExc_BufferError, "Writable buffer requested for readonly storage");
+            return -1;
+        }
+        view->buf = info->ptr;
+        view->itemsize = info->itemsize;
+        view->len = info->itemsize * info->size;
+        view->readonly = info->readonly;
+        if ((flags & PyBUF_FORMAT) == PyBUF_FORMAT)
+            view->format = const_cast<char *>(info->format.c_str());
+        view->ndim = (int) info->ndim;
+        view->shape = info->shape.data();
+        view->strides = info->strides.data();
+        // The contiguity requests include PyBUF_STRIDES; without strides, the memory must be
+        // C-contiguous
+        char order = 'C';
+        if ((flags & PyBUF_C_CONTIGUOUS) != PyBUF_C_CONTIGUOUS) {
+            if ((flags & PyBUF_F_CONTIGUOUS) == PyBUF_F_CONTIGUOUS)
+                order = 'F';
+            else if ((flags & PyBUF_ANY_CONTIGUOUS) == PyBUF_ANY_CONTIGUOUS)
+                order = 'A';
+            else if ((flags & PyBUF_STRIDES) == PyBUF_STRIDES)
+                order = 0;
+        }
+        if (order && !PyBuffer_IsContiguous(view, order)) {
+            std::memset(view, 0, sizeof(Py_buffer));
+            PyErr_SetString(PyExc_BufferError, "Contiguous buffer requested for discontiguous storage");
+            return -1;
+        }
+        if ((flags & PyBUF_STRIDES) != PyBUF_STRIDES)
+            view->strides = nullptr;
+        if ((flags & PyBUF_ND) != PyBUF_ND) {
+            view->ndim = 1;
+            view->shape = nullptr;
+        }
+        view->obj = obj;
+        Py_INCREF(view->obj);
+        return 0;
+    }
+
+    static void dealloc(PyObject *obj) {
+        auto self = (buffer_exporter *) obj;
+        delete self->info;
+        Py_XDECREF(self->owner);
+        PyObject_Free(obj);
+    }
+};
+PYBIND11_NAMESPACE_END(detail)
+
+/** \rst
+    Wraps a ``pickle.PickleBuffer`` (Python 3.8+). When a ``__reduce_ex__`` or the ``__getstate__``
+    of a ``py::pickle()`` definition returns one, pickle protocol 5 can hand the memory it refers
+    to over to a ``buffer_callback`` instead of copying it into the pickled data.
+\endrst */
+class pickle_buffer : public object {
+public:
+    PYBIND11_OBJECT_DEFAULT(pickle_buffer, object, PyPickleBuffer_Check)
+
+    /// Refers to the memory of an object supporting the buffer protocol
+    explicit pickle_buffer(handle exporter)
+        : object(PyPickleBuffer_FromObject(exporter.ptr()), stolen_t{}) {
+        if (!m_ptr) throw error_already_set();
+    }
+
+    /// Refers to the (contiguous) memory described by `info`, which is kept valid by `owner`
+    /// (typically, the Python object being pickled)
+    pickle_buffer(buffer_info info, handle owner) {
+        auto exporter = PyObject_New(detail::buffer_exporter, detail::buffer_exporter::type());
+        if (!exporter) throw error_already_set();
+        exporter->info = new buffer_info(std::move(info));
+        exporter->owner = owner.inc_ref().ptr();
+        auto exporter_object = reinterpret_steal<object>((PyObject *) exporter);
+        m_ptr = PyPickleBuffer_FromObject(exporter_object.ptr());
+        if (!m_ptr) throw error_already_set();
+    }
+};
+#endif
 /// @} pytypes
 
 /// \addtogroup python_builtins
@@ -1602,7 +1762,8 @@ template <typename D> args_proxy object_api<D>::operator*() const {
     return args_proxy(derived().ptr());
 }
 template <typename D> template <typename T> bool object_api<D>::contains(T &&item) const {
-    return attr("__contains__")(std::forward<T>(item)).template cast<bool>();
+    static const interned_str contains_key("__contains__");
+    return attr(contains_key)(std::forward<T>(item)).template cast<bool>();
 }
 
 template <typename D>
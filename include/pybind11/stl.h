@@ -164,19 +164,52 @@ private:
     void reserve_maybe(sequence s, Type *) { value.reserve(s.size()); }
     void reserve_maybe(sequence, void *) { }
 
-public:
     template <typename T>
-    static handle cast(T &&src, return_value_policy policy, handle parent) {
-        if (!std::is_lvalue_reference<T>::value)
-            policy = return_value_policy_override<Value>::policy(policy);
-        list l(src.size());
+    static bool cast_elements(list &l, T &&src, return_value_policy policy, handle parent,
+                              std::false_type /* bulk */) {
         size_t index = 0;
         for (auto &&value : src) {
             auto value_ = reinterpret_steal<object>(value_conv::cast(forward_like<T>(value), policy, parent));
             if (!value_)
-                return handle();
+                return false;
+            PyList_SET_ITEM(l.ptr(), (ssize_t) index++, value_.release().ptr()); // steals a reference
+        }
+        return true;
+    }
+
+    // Elements of a temporary container of a registered type are moved into new instances with a
+    // single type lookup, skipping the search for existing instances (they can't have any). Other
+    // policies than moving take the element-wise path.
+    template <typename T>
+    static bool cast_elements(list &l, T &&src, return_value_policy policy, handle parent,
+                              std::true_type /* bulk */) {
+        auto tinfo = policy == return_value_policy::move || policy == return_value_policy::automatic
+                         ? get_type_info(typeid(Value)) : nullptr;
+        if (!tinfo)
+            return cast_elements(l, std::forward<T>(src), policy, parent, std::false_type{});
+        size_t index = 0;
+        for (auto &value : src) {
+            auto value_ = reinterpret_steal<object>(value_conv::cast_new(std::move(value), parent, tinfo));
+            if (!value_)
+                return false;
             PyList_SET_ITEM(l.ptr(), (ssize_t) index++, value_.release().ptr()); // steals a reference
         }
+        return true;
+    }
+
+    template <typename T>
+    using bulk_cast = bool_constant<!std::is_lvalue_reference<T>::value &&
+                                    !std::is_const<remove_reference_t<T>>::value &&
+                                    is_generic_caster<Value>::value>;
+
+public:
+    template <typename T>
+    static handle cast(T &&src, return_value_policy policy, handle parent) {
+        if (!std::is_lvalue_reference<T>::value)
+            policy = return_value_policy_override<Value>::policy(policy);
+        list l(src.size());
+        if (!cast_elements(l, std::forward<T>(src), policy, parent, bulk_cast<T>{}))
+            return handle();
         return l.release();
     }
 
@@ -337,26 +370,60 @@ template <template<typename...> class V, typename... Ts>
 struct variant_caster<V<Ts...>> {
     static_assert(sizeof...(Ts) > 0, "Variant must consist of at least one alternative.");
 
+    /// Bit `i` of a mask is set if alternative `i` can't be loaded without conversions
+    using skip_mask = std::uint64_t;
+
     template <typename U, typename... Us>
-    bool load_alternative(handle src, bool convert, type_list<U, Us...>) {
-        auto caster = make_caster<U>();
-        if (caster.load(src, convert)) {
-            value = cast_op<U>(caster);
-            return true;
+    bool load_alternative(handle src, bool convert, skip_mask skip, type_list<U, Us...>) {
+        if (!(skip & 1)) {
+            auto caster = make_caster<U>();
+            if (caster.load(src, convert)) {
+                value = cast_op<U>(caster);
+                return true;
+            }
         }
-        return load_alternative(src, convert, type_list<Us...>{});
+        return load_alternative(src, convert, skip >> 1, type_list<Us...>{});
     }
 
-    bool load_alternative(handle, bool, type_list<>) { return false; }
+    bool load_alternative(handle, bool, skip_mask, type_list<>) { return false; }
+
+#if !defined(PYPY_VERSION) && PY_MAJOR_VERSION >= 3
+    static constexpr bool use_dispatch_table = sizeof...(Ts) > 1 && sizeof...(Ts) <= 64 &&
+                                               any_of<bool_constant<type_load_filter<Ts>::informative>...>::value;
+#else
+    static constexpr bool use_dispatch_table = false;
+#endif
+
+    /// Returns the alternatives that can't load objects of the given exact type without
+    /// conversions (computed once per type)
+    template <bool Enable = use_dispatch_table, enable_if_t<Enable, int> = 0>
+    static skip_mask skipped_alternatives(PyTypeObject *type) {
+        static std::unordered_map<PyTypeObject *, skip_mask> table;
+        static type_registry_version version;
+        return type_table_get(table, version, type, [](PyTypeObject *type) {
+            bool may_load[] = {type_load_filter<Ts>::may_load(type)...};
+            skip_mask skip = 0;
+            for (size_t i = 0; i < sizeof...(Ts); ++i)
+                if (!may_load[i])
+                    skip |= skip_mask(1) << i;
+            return skip;
+        });
+    }
+
+    template <bool Enable = use_dispatch_table, enable_if_t<!Enable, int> = 0>
+    static skip_mask skipped_alternatives(PyTypeObject *) { return 0; }
 
     bool load(handle src, bool convert) {
+        if (!src)
+            return false;
+        auto skip = skipped_alternatives(Py_TYPE(src.ptr()));
         // Do a first pass without conversions to improve constructor resolution.
         // E.g. `py::int_(1).cast<variant<double, int>>()` needs to fill the `int`
         // slot of the variant. Without two-pass loading `double` would be filled
         // because it appears first and a conversion is possible.
-        if (convert && load_alternative(src, false, type_list<Ts...>{}))
+        if (convert && load_alternative(src, false, skip, type_list<Ts...>{}))
             return true;
-        return load_alternative(src, convert, type_list<Ts...>{});
+        return load_alternative(src, convert, convert ? 0 : skip, type_list<Ts...>{});
     }
 
     template <typename Variant>
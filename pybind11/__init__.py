@@ -2,6 +2,7 @@
 
 from ._version import version_info, __version__
 from .commands import get_include, get_cmake_dir
+from .import_profile import profile_import
 
 
 __all__ = (
@@ -9,4 +10,5 @@ __all__ = (
     "__version__",
     "get_include",
     "get_cmake_dir",
+    "profile_import",
 )
@@ -6,6 +6,7 @@ import sys
 import sysconfig
 
 from .commands import get_include, get_cmake_dir
+from .import_profile import profile_import, format_import_profile
 
 
 def print_includes():
@@ -39,6 +40,11 @@ def main():
         action="store_true",
         help="Print the CMake module directory, ideal for setting -Dpybind11_ROOT in CMake.",
     )
+    parser.add_argument(
+        "--profile-import",
+        metavar="MODULE",
+        help="Import a module and print the slowest steps of the initialization of its pybind11 modules.",
+    )
     args = parser.parse_args()
     if not sys.argv[1:]:
         parser.print_help()
@@ -46,6 +52,8 @@ def main():
         print_includes()
     if args.cmakedir:
         print(get_cmake_dir())
+    if args.profile_import:
+        print(format_import_profile(profile_import(args.profile_import)))
 
 
 if __name__ == "__main__":
@@ -0,0 +1,67 @@
+# -*- coding: utf-8 -*-
+"""
+Profiling of the initialization of pybind11 modules while they are imported.
+"""
+
+import collections
+import importlib
+import sys
+
+try:
+    import builtins
+except ImportError:  # Python 2
+    import __builtin__ as builtins  # type: ignore
+
+# Where pybind11 modules look for the list to append their records to (see
+# ``import_profile_module`` in ``pybind11.h``)
+_RECORDS = "__pybind11_import_profile__"
+
+ImportProfileRecord = collections.namedtuple(
+    "ImportProfileRecord", ["kind", "name", "seconds", "allocated_blocks"]
+)
+ImportProfileRecord.__doc__ = """
+A step of the initialization of a module: ``kind`` is one of ``"module"`` (the
+whole initialization of the module called ``name``), ``"class"`` (creating the
+type), ``"function"`` or ``"method"`` (creating a function and adding it to its
+scope). ``allocated_blocks`` is the number of memory blocks allocated by Python
+meanwhile (0 if not available), which includes those of nested steps.
+"""
+
+
+def profile_import(name):
+    # type: (str) -> list
+    """
+    Imports the module ``name`` and returns an ``ImportProfileRecord`` for each
+    step of the initialization of the pybind11 modules (built with this version
+    of pybind11) it imports, in the order in which the steps were completed.
+    """
+    if name in sys.modules:
+        raise ValueError("Module {!r} has already been imported".format(name))
+
+    records = []  # type: list
+    setattr(builtins, _RECORDS, records)
+    try:
+        importlib.import_module(name)
+    finally:
+        delattr(builtins, _RECORDS)
+    return [ImportProfileRecord(*record) for record in records]
+
+
+def format_import_profile(records, limit=20):
+    # type: (list, int) -> str
+    """
+    Formats the modules and the ``limit`` slowest other steps of an import
+    profile as a table.
+    """
+    modules = [r for r in records if r.kind == "module"]
+    steps = sorted(
+        (r for r in records if r.kind != "module"), key=lambda r: -r.seconds
+    )[:limit]
+    lines = ["{:>10} {:>8}  {:<8} {}".format("ms", "blocks", "kind", "name")]
+    for r in modules + steps:
+        lines.append(
+            "{:10.3f} {:8d}  {:<8} {}".format(
+                r.seconds * 1000, r.allocated_blocks, r.kind, r.name
+            )
+        )
+    return "\n".join(lines)
@@ -60,6 +60,7 @@ py_files = {
     "_version.py",
     "_version.pyi",
     "commands.py",
+    "import_profile.py",
     "py.typed",
     "setup_helpers.py",
     "setup_helpers.pyi",
@@ -37,6 +37,15 @@ def test_bound_method_callback():
     z = MyClass()
     assert m.test_callback3(z.double) == "func(43) = 86"
 
+    # Positional calls from C++ may let the callee reuse the argument array to prepend `self`
+    class MyOtherClass:
+        def collect(self, *args):
+            return (self,) + args
+
+    z = MyOtherClass()
+    assert m.test_callback2(z.collect) == (z, "Hello", "x", True, 5)
+    assert m.test_callback2(z.collect) == (z, "Hello", "x", True, 5)
+
     z = m.CppBoundMethodTest()
     assert m.test_callback3(z.triple) == "func(43) = 129"
 
@@ -114,6 +114,7 @@ TEST_SUBMODULE(class_, m) {
     };
     struct DerivedClass1 : BaseClass { };
     struct DerivedClass2 : BaseClass { };
+    struct DerivedClass3 : BaseClass { };
 
     py::class_<BaseClass>(m, "BaseClass").def(py::init<>());
     py::class_<DerivedClass1>(m, "DerivedClass1").def(py::init<>());
@@ -124,8 +125,12 @@ TEST_SUBMODULE(class_, m) {
     m.def("return_class_n", [](int n) -> BaseClass* {
         if (n == 1) return new DerivedClass1();
         if (n == 2) return new DerivedClass2();
+        if (n == 3) return new DerivedClass3();
         return new BaseClass();
     });
+    m.def("register_derived_class_3", [](py::module_ m) {
+        py::class_<DerivedClass3, BaseClass>(m, "DerivedClass3");
+    });
     m.def("return_none", []() -> BaseClass* { return nullptr; });
 
     // test_isinstance
@@ -219,6 +224,40 @@ TEST_SUBMODULE(class_, m) {
     py::implicitly_convertible<UserType, ConvertibleFromUserType>();
 
     m.def("implicitly_convert_argument", [](const ConvertibleFromUserType &r) { return r.i; });
+
+    // test_implicit_conversion_stats
+    struct ConvertibleFromMany {
+        std::string source;
+    };
+    py::class_<ConvertibleFromMany>(m, "ConvertibleFromMany")
+        .def(py::init([](UserType) { return ConvertibleFromMany{"UserType"}; }))
+        .def(py::init([](const std::string &) { return ConvertibleFromMany{"str"}; }))
+        .def(py::init([](int) { return ConvertibleFromMany{"int"}; }));
+    py::implicitly_convertible<UserType, ConvertibleFromMany>();
+    py::implicitly_convertible<std::string, ConvertibleFromMany>();
+    py::implicitly_convertible<int, ConvertibleFromMany>();
+    m.def("convert_from_many", [](const ConvertibleFromMany &c) { return c.source; });
+
+    // test_cpp_conversion
+    struct CppSource {
+        int value;
+    };
+    struct CppTarget {
+        CppTarget(const CppSource &s) : value(2 * s.value) { print_created(this, value); }
+        CppTarget(const CppTarget &t) : value(t.value) { print_copy_created(this); }
+        ~CppTarget() { print_destroyed(this); }
+        int value;
+    };
+    py::class_<CppSource>(m, "CppSource")
+        .def(py::init([](int value) { return CppSource{value}; }));
+    // CppTarget has no constructor bound: the conversion doesn't go through Python
+    py::class_<CppTarget>(m, "CppTarget");
+    py::implicitly_convertible<CppSource, CppTarget>(py::cpp_conversion());
+    m.def("cpp_target_value", [](const CppTarget &t) { return t.value; });
+    m.def("implicit_conversion_stats", [](py::handle type) {
+        auto stats = py::get_implicit_conversion_stats(type);
+        return py::make_tuple(stats.attempts, stats.succeeded, stats.skipped);
+    });
     m.def("implicitly_convert_variable", [](py::object o) {
         // `o` is `UserType` and `r` is a reference to a temporary created by implicit
         // conversion. This is valid when called inside a bound function because the temp
@@ -457,6 +496,63 @@ TEST_SUBMODULE(class_, m) {
     py::class_<DerivedWithNested::Nested>(derivedWithNested_class, "Nested")
         .def_static("get_name", []() { return "DerivedWithNested::Nested"; });
 
+    // test_inline_storage
+    struct InlineVector {
+        InlineVector(double x, double y) : x(x), y(y) { print_created(this, x, y); }
+        InlineVector(const InlineVector &v) : x(v.x), y(v.y) { print_copy_created(this); }
+        InlineVector(InlineVector &&v) : x(v.x), y(v.y) { print_move_created(this); }
+        ~InlineVector() { print_destroyed(this); }
+        double x, y;
+    };
+    py::class_<InlineVector>(m, "InlineVector", py::inline_storage())
+        .def(py::init<double, double>())
+        .def_readwrite("x", &InlineVector::x)
+        .def_readwrite("y", &InlineVector::y)
+        .def("__add__", [](const InlineVector &a, const InlineVector &b) {
+            return InlineVector(a.x + b.x, a.y + b.y);
+        })
+        .def_static("copy_of", [](const InlineVector &v) {
+            InlineVector local(v.x, v.y);
+            return py::cast(local, py::return_value_policy::copy);
+        })
+        .def_static("new_instance", []() { return new InlineVector(7, 8); });
+    m.def("is_stored_inline", [](py::handle h) {
+        auto value = reinterpret_cast<const char *>(&h.cast<const InlineVector &>());
+        auto begin = reinterpret_cast<const char *>(h.ptr());
+        return value >= begin && value < begin + Py_TYPE(h.ptr())->tp_basicsize;
+    });
+
+    struct InlineShared {};
+    m.def("register_inline_shared", [](py::module_ m) {
+        py::class_<InlineShared, std::shared_ptr<InlineShared>>(m, "InlineShared", py::inline_storage());
+    });
+
+    // test_free_list
+    struct FreeListVector { double x, y; };
+    py::class_<FreeListVector>(m, "FreeListVector", py::inline_storage(), py::free_list(2))
+        .def(py::init<double, double>())
+        .def_readonly("x", &FreeListVector::x)
+        .def_readonly("y", &FreeListVector::y);
+    m.def("free_list_stats", [](py::handle type) {
+        auto stats = py::get_free_list_stats(type);
+        return py::make_tuple(stats.size, stats.max_size, stats.reused, stats.allocated);
+    });
+
+    struct FreeListDynamic {};
+    m.def("register_free_list_dynamic_attr", [](py::module_ m) {
+        py::class_<FreeListDynamic>(m, "FreeListDynamic", py::free_list(), py::dynamic_attr());
+    });
+
+    // test_no_weakref
+    struct ObjectId { std::int64_t id; };
+    py::class_<ObjectId>(m, "ObjectId", py::inline_storage())
+        .def(py::init<std::int64_t>())
+        .def_readonly("id", &ObjectId::id);
+    struct CompactObjectId { std::int64_t id; };
+    py::class_<CompactObjectId>(m, "CompactObjectId", py::inline_storage(), py::no_weakref())
+        .def(py::init<std::int64_t>())
+        .def_readonly("id", &CompactObjectId::id);
+
     // test_register_duplicate_class
     struct Duplicate {};
     struct OtherDuplicate {};
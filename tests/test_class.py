@@ -207,6 +207,18 @@ def test_automatic_upcasting():
     assert type(m.return_class_n(1)).__name__ == "DerivedClass1"
 
 
+def test_automatic_upcasting_registration():
+    import types
+
+    # Resolved dynamic types are cached, so that cache must notice newly registered types
+    for _ in range(3):
+        assert type(m.return_class_n(3)).__name__ == "BaseClass"
+    m.register_derived_class_3(types.ModuleType("module_scope"))
+    for n in [3, 1, 3, 2, 0, 3]:
+        expected = ["BaseClass", "DerivedClass1", "DerivedClass2", "DerivedClass3"][n]
+        assert type(m.return_class_n(n)).__name__ == expected
+
+
 def test_isinstance():
     objects = [tuple(), dict(), m.Pet("Polly", "parrot")] + [m.Dog("Molly")] * 4
     expected = (True, True, True, True, True, False, False)
@@ -252,6 +264,36 @@ def test_implicit_conversion_life_support():
     assert "outside a bound function" in m.implicitly_convert_variable_fail(UserType(5))
 
 
+def test_implicit_conversion_stats():
+    stats = m.implicit_conversion_stats
+    assert stats(m.ConvertibleFromMany) == (0, 0, 0)
+    # Conversions which can't apply to the source type are skipped without being tried
+    assert m.convert_from_many(1) == "int"
+    assert stats(m.ConvertibleFromMany) == (1, 1, 2)
+    assert m.convert_from_many("a") == "str"
+    assert stats(m.ConvertibleFromMany) == (2, 2, 3)
+    assert m.convert_from_many(UserType(1)) == "UserType"
+    assert stats(m.ConvertibleFromMany) == (3, 3, 3)
+    with pytest.raises(TypeError):
+        m.convert_from_many(2 ** 70)
+    assert stats(m.ConvertibleFromMany) == (4, 3, 5)
+    assert stats(UserType) == (0, 0, 0)
+
+
+def test_cpp_conversion():
+    class Source(m.CppSource):
+        pass
+
+    cstats = ConstructorStats.get(m.CppTarget)
+    assert m.cpp_target_value(m.CppSource(21)) == 42
+    assert m.cpp_target_value(Source(4)) == 8
+    assert cstats.alive() == 0
+    assert cstats.values() == ["42", "8"]
+    assert m.implicit_conversion_stats(m.CppTarget) == (2, 2, 0)
+    with pytest.raises(TypeError):
+        m.cpp_target_value(21)
+
+
 def test_operator_new_delete(capture):
     """Tests that class-specific operator new/delete functions are invoked"""
 
@@ -434,6 +476,131 @@ def test_base_and_derived_nested_scope():
     assert m.DerivedWithNested.Nested.get_name() == "DerivedWithNested::Nested"
 
 
+def test_inline_storage():
+    cstats = ConstructorStats.get(m.InlineVector)
+    a = m.InlineVector(1, 2)
+    assert m.is_stored_inline(a)
+
+    b = a + m.InlineVector(3, 4)
+    assert m.is_stored_inline(b)
+    assert (b.x, b.y) == (4, 6)
+
+    c = m.InlineVector.copy_of(a)
+    assert m.is_stored_inline(c)
+    c.x = 10
+    assert (a.x, c.x) == (1, 10)
+
+    d = m.InlineVector.new_instance()
+    assert not m.is_stored_inline(d)
+    assert d.y == 8
+
+    class Sub(m.InlineVector):
+        pass
+
+    s = Sub(5, 6)
+    s.tag = "sub"
+    assert m.is_stored_inline(s)
+    assert (s.x, s.y, s.tag) == (5, 6, "sub")
+
+    pytest.gc_collect()
+    assert cstats.alive() == 5
+    del a, b, c, d, s
+    pytest.gc_collect()
+    assert cstats.alive() == 0
+    assert cstats.copy_constructions == 1
+    assert cstats.move_constructions >= 1
+
+
+def test_inline_storage_holder():
+    import types
+
+    with pytest.raises(RuntimeError) as exc_info:
+        m.register_inline_shared(types.ModuleType("module_scope"))
+    assert str(exc_info.value) == (
+        'generic_type: type "InlineShared" uses py::inline_storage(), '
+        "which requires the default holder type"
+    )
+
+
+@pytest.mark.skipif("env.PYPY", reason="free lists are not used on PyPy")
+def test_free_list():
+    assert m.free_list_stats(m.FreeListVector) == (0, 2, 0, 0)
+    vectors = [m.FreeListVector(i, -i) for i in range(3)]
+    assert m.free_list_stats(m.FreeListVector) == (0, 2, 0, 3)
+    del vectors
+    assert m.free_list_stats(m.FreeListVector) == (2, 2, 0, 3)
+
+    v = m.FreeListVector(5, 6)
+    assert (v.x, v.y) == (5, 6)
+    assert m.free_list_stats(m.FreeListVector) == (1, 2, 1, 3)
+
+    class Sub(m.FreeListVector):
+        pass
+
+    s = Sub(7, 8)
+    assert (s.x, s.y) == (7, 8)
+    del s
+    assert m.free_list_stats(m.FreeListVector) == (1, 2, 1, 3)
+    assert m.free_list_stats(Sub) == (0, 0, 0, 0)
+    assert m.free_list_stats(m.InlineVector) == (0, 0, 0, 0)
+
+
+def test_free_list_dynamic_attr():
+    import types
+
+    with pytest.raises(RuntimeError) as exc_info:
+        m.register_free_list_dynamic_attr(types.ModuleType("module_scope"))
+    assert str(exc_info.value) == (
+        'generic_type: type "FreeListDynamic" cannot combine '
+        "py::free_list() with py::dynamic_attr()"
+    )
+
+
+def test_no_weakref():
+    import weakref
+
+    c = m.CompactObjectId(42)
+    assert c.id == 42
+    assert m.CompactObjectId.__weakrefoffset__ == 0
+    assert m.ObjectId.__weakrefoffset__ != 0
+    with pytest.raises(TypeError):
+        weakref.ref(c)
+    assert m.CompactObjectId.__basicsize__ < m.ObjectId.__basicsize__
+
+    # Python subclasses add their own weak reference slot
+    class Sub(m.CompactObjectId):
+        pass
+
+    s = Sub(7)
+    assert weakref.ref(s)() is s
+
+
+@pytest.mark.skipif("env.PYPY", reason="tracemalloc is not available on PyPy")
+def test_no_weakref_memory():
+    import tracemalloc
+
+    def bytes_per_instance(cls, count=10000):
+        tracemalloc.start()
+        try:
+            before = tracemalloc.get_traced_memory()[0]
+            instances = [cls(i) for i in range(count)]
+            size = tracemalloc.get_traced_memory()[0] - before
+            del instances
+        finally:
+            tracemalloc.stop()
+        return size / count
+
+    regular = bytes_per_instance(m.ObjectId)
+    compact = bytes_per_instance(m.CompactObjectId)
+    print(
+        "bytes per instance: {:.1f} (regular), {:.1f} (py::no_weakref)".format(
+            regular, compact
+        )
+    )
+    saved = m.ObjectId.__basicsize__ - m.CompactObjectId.__basicsize__
+    assert regular - compact >= 0.9 * saved
+
+
 def test_register_duplicate_class():
     import types
 
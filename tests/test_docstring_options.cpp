@@ -66,4 +66,11 @@ TEST_SUBMODULE(docstring_options, m) {
             .def_property("value_prop", &DocstringTestFoo::getValue, &DocstringTestFoo::setValue, "This is a property docstring")
         ;
     }
+    // Docstrings are generated at the end of the initialization of the module, and so can refer
+    // to types registered after the function
+    struct DocstringTestLater {};
+    m.def("test_function9", [](const DocstringTestLater &) {}, py::arg("later"));
+    m.def("test_function10", [](int) {}, "First overload");
+    m.def("test_function10", [](const DocstringTestLater &) {}, "Second overload");
+    py::class_<DocstringTestLater>(m, "DocstringTestLater");
 }
@@ -1,4 +1,6 @@
 # -*- coding: utf-8 -*-
+import types
+
 from pybind11_tests import docstring_options as m
 
 
@@ -40,3 +42,18 @@ def test_docstring_options():
     # Suppression of user-defined docstrings for non-function objects
     assert not m.DocstringTestFoo.__doc__
     assert not m.DocstringTestFoo.value_prop.__doc__
+
+
+def test_docstrings_of_later_types():
+    # Before any access to the docstring
+    assert type(m.test_function9) is types.BuiltinFunctionType
+
+    later = "pybind11_tests.docstring_options.DocstringTestLater"
+    assert m.test_function9.__doc__ == "test_function9(later: {}) -> None\n".format(
+        later
+    )
+
+    doc = m.test_function10.__doc__
+    assert doc.startswith("test_function10(*args, **kwargs)\nOverloaded function.")
+    assert "1. test_function10(arg0: int) -> None\n\nFirst overload\n" in doc
+    assert "2. test_function10(arg0: {}) -> None\n\nSecond".format(later) in doc
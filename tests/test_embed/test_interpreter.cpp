@@ -11,6 +11,7 @@
 #include <thread>
 #include <fstream>
 #include <functional>
+#include <future>
 
 namespace py = pybind11;
 using namespace py::literals;
@@ -33,11 +34,21 @@ class PyWidget final : public Widget {
     int the_answer() const override { PYBIND11_OVERRIDE_PURE(int, Widget, the_answer); }
 };
 
+class ConcreteWidget : public Widget {
+public:
+    using Widget::Widget;
+
+    int the_answer() const override { return 42; }
+};
+
 PYBIND11_EMBEDDED_MODULE(widget_module, m) {
     py::class_<Widget, PyWidget>(m, "Widget")
         .def(py::init<std::string>())
         .def_property_readonly("the_message", &Widget::the_message);
 
+    py::class_<ConcreteWidget, Widget>(m, "ConcreteWidget");
+    m.def("create_concrete", [](std::string message) -> Widget * { return new ConcreteWidget(message); });
+
     m.def("add", [](int i, int j) { return i + j; });
 }
 
@@ -105,9 +116,18 @@ bool has_pybind11_internals_static() {
     return ipp && *ipp;
 }
 
+/// Uses a static interned string, which must be created again after a restart
+std::string module_name(py::handle module_) {
+    static const py::interned_str name_key("__name__");
+    return module_.attr(name_key).cast<std::string>();
+}
+
 TEST_CASE("Restart the interpreter") {
     // Verify pre-restart state.
+    REQUIRE(module_name(py::module_::import("widget_module")) == "widget_module");
     REQUIRE(py::module_::import("widget_module").attr("add")(1, 2).cast<int>() == 3);
+    REQUIRE(py::module_::import("widget_module").attr("create_concrete")("before restart")
+                .attr("__class__").attr("__name__").cast<std::string>() == "ConcreteWidget");
     REQUIRE(has_pybind11_internals_builtin());
     REQUIRE(has_pybind11_internals_static());
     REQUIRE(py::module_::import("external_module").attr("A")(123).attr("value").cast<int>() == 123);
@@ -151,6 +171,12 @@ TEST_CASE("Restart the interpreter") {
     // C++ modules can be reloaded.
     auto cpp_module = py::module_::import("widget_module");
     REQUIRE(cpp_module.attr("add")(1, 2).cast<int>() == 3);
+    REQUIRE(module_name(cpp_module) == "widget_module");
+
+    // Polymorphic type lookups cached before the restart aren't reused.
+    auto concrete = cpp_module.attr("create_concrete")("after restart");
+    REQUIRE(concrete.attr("__class__").attr("__name__").cast<std::string>() == "ConcreteWidget");
+    REQUIRE(concrete.attr("the_message").cast<std::string>() == "after restart");
 
     // C++ type information is reloaded and can be used in python modules.
     auto py_module = py::module_::import("test_interpreter");
@@ -234,6 +260,39 @@ TEST_CASE("Threads") {
     REQUIRE(locals["count"].cast<int>() == num_threads);
 }
 
+TEST_CASE("Persistent thread states") {
+    std::promise<void> persisted, restarted;
+    auto restarted_future = restarted.get_future();
+    bool reused = false;
+
+    std::thread worker;
+    {
+        py::gil_scoped_release gil_release{};
+        worker = std::thread([&]() {
+            {
+                py::gil_scoped_acquire gil{};
+                gil.persist();
+            }
+            reused = PyGILState_GetThisThreadState() != nullptr;
+            persisted.set_value();
+            // Exit only after the interpreter has been restarted: the persisted thread state
+            // was destroyed by Py_Finalize() and must not be touched at thread exit.
+            restarted_future.wait();
+        });
+        persisted.get_future().wait();
+    }
+    REQUIRE(reused);
+
+    py::finalize_interpreter();
+    py::initialize_interpreter();
+    restarted.set_value();
+    {
+        py::gil_scoped_release gil_release{};
+        worker.join();
+    }
+    REQUIRE(py::eval("1 + 1").cast<int>() == 2);
+}
+
 // Scope exit utility https://stackoverflow.com/a/36644501/7255855
 struct scope_exit {
     std::function<void()> f_;
@@ -96,4 +96,42 @@ TEST_SUBMODULE(eval_, m) {
         auto int_class = py::eval("isinstance(42, int)", global);
         return global;
     });
+
+    // test_compiled_code
+    m.def("eval_compiled_code", []() {
+        auto expr = py::compile("x * 2");
+        auto statements = py::compile<py::eval_statements>(R"(
+            y = x + 1
+            z = y * 2
+            )");
+        py::list results;
+        for (int x = 0; x < 3; ++x) {
+            auto local = py::dict();
+            local["x"] = x;
+            results.append(py::eval(expr, py::dict(), local));
+            py::exec(statements, py::dict(), local);
+            results.append(py::make_tuple(local["y"], local["z"]));
+        }
+        return results;
+    });
+
+    m.def("compile_failure", []() { py::compile("nonsense code ..."); });
+
+    // test_eval_cache
+    m.def("eval_cache", [](size_t size) {
+        py::set_eval_cache_size(size);
+        auto &cache = py::detail::get_eval_cache();
+        auto local = py::dict();
+        local["n"] = 1;
+        py::list results;
+        for (const char *expr : {"n + 1", "n + 2", "n + 1", "n * 3"}) {
+            auto result = py::eval(expr, py::dict(), local);
+            py::list keys;
+            for (const auto &entry : cache.entries)
+                keys.append(entry.first);
+            results.append(py::make_tuple(result, keys));
+        }
+        py::set_eval_cache_size(0);
+        return results;
+    });
 }
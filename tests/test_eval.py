@@ -33,3 +33,25 @@ def test_eval_empty_globals():
     g = {}
     assert "__builtins__" in m.eval_empty_globals(g)
     assert "__builtins__" in g
+
+
+def test_compiled_code():
+    assert m.eval_compiled_code() == [0, (1, 2), 2, (2, 4), 4, (3, 6)]
+
+    with pytest.raises(SyntaxError):
+        m.compile_failure()
+
+
+def test_eval_cache():
+    assert m.eval_cache(2) == [
+        (2, ["0:n + 1"]),
+        (3, ["0:n + 2", "0:n + 1"]),
+        (2, ["0:n + 1", "0:n + 2"]),
+        (3, ["0:n * 3", "0:n + 1"]),
+    ]
+    assert m.eval_cache(0) == [
+        (2, []),
+        (3, []),
+        (2, []),
+        (3, []),
+    ]
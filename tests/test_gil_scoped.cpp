@@ -9,8 +9,18 @@
 
 #include "pybind11_tests.h"
 #include <pybind11/functional.h>
+#include <chrono>
+#include <thread>
 
 
+bool gil_held() {
+    return py::detail::get_thread_state_unchecked() == PyGILState_GetThisThreadState();
+}
+
+struct NoGilStruct {
+    bool gil_held() const { return ::gil_held(); }
+};
+
 class VirtClass  {
 public:
     virtual ~VirtClass() = default;
@@ -51,4 +61,66 @@ TEST_SUBMODULE(gil_scoped, m) {
               py::gil_scoped_release gil_release;
               gil_acquire();
           });
+    // Returns how many times a C++ worker thread entered Python with a thread state that was
+    // kept alive from a previous acquisition.
+    m.def("reused_thread_states",
+          [](int iterations, bool persist) {
+              int reused = 0;
+              py::gil_scoped_release gil_release;
+              std::thread worker([&]() {
+                  for (int i = 0; i < iterations; i++) {
+                      if (PyGILState_GetThisThreadState() != nullptr)
+                          reused++;
+                      py::gil_scoped_acquire gil_acquire;
+                      if (persist)
+                          gil_acquire.persist();
+                  }
+              });
+              worker.join();
+              return reused;
+          }, py::arg("iterations"), py::arg("persist"));
+    // test_default_gil_release
+    {
+        py::options options;
+        options.enable_default_gil_release();
+        m.def("released_int", [](int) { return !gil_held(); });
+        m.def("released_pair", [](const std::pair<int, std::string> &) { return !gil_held(); });
+        m.def("held_object", [](py::object) { return !gil_held(); });
+        m.def("held_object_pair", [](const std::pair<int, py::object> &) { return !gil_held(); });
+        m.def("held_function", [](const std::function<void()> &) { return !gil_held(); });
+        m.def("held_return_object", []() { return py::bool_(!gil_held()); });
+        m.def("guarded_release", [](int) { return !gil_held(); },
+              py::call_guard<py::gil_scoped_release>());
+        m.def("guarded_acquire", [](int) { return !gil_held(); },
+              py::call_guard<py::gil_scoped_acquire>());
+        py::class_<NoGilStruct>(m, "NoGilStruct")
+            .def(py::init<>())
+            .def("gil_held", &NoGilStruct::gil_held);
+    }
+    m.def("held_default_off", [](int) { return !gil_held(); });
+
+    // Micro-benchmark: average cost in nanoseconds of one nested acquire/release pair while
+    // the GIL is already held (the common case inside callbacks). With `released`, the
+    // outermost acquisition of each iteration has to actually take the GIL.
+    m.def("nested_acquire_ns",
+          [](int iterations, int depth, bool released) {
+              auto run = [&]() {
+                  for (int i = 0; i < iterations; i++) {
+                      py::gil_scoped_acquire outer;
+                      for (int d = 1; d < depth; d++) {
+                          py::gil_scoped_acquire inner;
+                      }
+                  }
+              };
+              auto start = std::chrono::steady_clock::now();
+              if (released) {
+                  py::gil_scoped_release gil_release;
+                  run();
+              } else {
+                  run();
+              }
+              std::chrono::duration<double, std::nano> elapsed =
+                  std::chrono::steady_clock::now() - start;
+              return elapsed.count() / (double) iterations / (double) depth;
+          }, py::arg("iterations"), py::arg("depth") = 2, py::arg("released") = false);
 }
@@ -92,3 +92,40 @@ def test_python_to_cpp_to_python_from_process():
 def test_cross_module_gil():
     """Makes sure that the GIL can be acquired by another module from a GIL-released state."""
     m.test_cross_module_gil()  # Should not raise a SIGSEGV
+
+
+def test_nested_acquire():
+    """Nested gil_scoped_acquire while the GIL is held (fast path) and after releasing it."""
+    assert m.nested_acquire_ns(1000) > 0
+    assert m.nested_acquire_ns(1000, depth=4, released=True) > 0
+
+    def nested_in_thread():
+        m.nested_acquire_ns(1000, depth=3)
+        m.nested_acquire_ns(1000, depth=3, released=True)
+
+    thread = threading.Thread(target=nested_in_thread)
+    thread.start()
+    thread.join()
+
+
+def test_persistent_thread_state():
+    """gil_scoped_acquire::persist() keeps the thread state of a C++ thread until it exits"""
+    assert m.reused_thread_states(10, persist=False) == 0
+    assert m.reused_thread_states(10, persist=True) == 9
+    # The thread state was destroyed when the previous worker exited
+    assert m.reused_thread_states(10, persist=True) == 9
+
+
+def test_default_gil_release():
+    """py::options::enable_default_gil_release() releases the GIL only when safe"""
+    assert m.released_int(1) is True
+    assert m.released_pair((1, "a")) is True
+    assert m.NoGilStruct().gil_held() is False
+    assert m.held_object(1) is False
+    assert m.held_object_pair((1, 2)) is False
+    assert m.held_function(lambda: None) is False
+    assert m.held_return_object() is False
+    # A call guard runs with the GIL held, and alone decides whether to release it
+    assert m.guarded_release(1) is True
+    assert m.guarded_acquire(1) is False
+    assert m.held_default_off(1) is False
@@ -223,6 +223,29 @@ TEST_SUBMODULE(methods_and_attributes, m) {
     // Issue #443: can't call copied methods in Python 3
     emna.attr("add2b") = emna.attr("add2");
 
+    // test_member_descriptors
+    struct MemberBase { int base_value = 1; };
+    struct MemberRecord : MemberBase {
+        double d = 0.5;
+        bool b = false;
+        std::string s = "abc";
+        const long c = 7;
+    };
+    struct MemberRecordChild : MemberRecord { int child_value = 2; };
+    py::class_<MemberRecord>(m, "MemberRecord")
+        .def(py::init<>())
+        .def_member_descriptor("base_value", &MemberRecord::base_value)
+        .def_member_descriptor("d", &MemberRecord::d)
+        .def_member_descriptor("d_readonly", &MemberRecord::d, true)
+        .def_member_descriptor("b", &MemberRecord::b)
+        .def_member_descriptor("s", &MemberRecord::s)
+        .def_member_descriptor("c", &MemberRecord::c)
+        .def_readwrite("s_readwrite", &MemberRecord::s)
+        .def_readwrite("s_property", &MemberRecord::s, "s as a property");
+    py::class_<MemberRecordChild, MemberRecord>(m, "MemberRecordChild")
+        .def(py::init<>())
+        .def_member_descriptor("child_value", &MemberRecordChild::child_value);
+
     // test_properties, test_static_properties, test_static_cls
     py::class_<TestProperties>(m, "TestProperties")
         .def(py::init<>())
@@ -118,6 +118,61 @@ def test_properties():
     assert "can't set attribute" in str(excinfo.value)
 
 
+def test_member_descriptors():
+    r = m.MemberRecord()
+    assert (r.base_value, r.d, r.b, r.s, r.c) == (1, 0.5, False, "abc", 7)
+    r.base_value, r.d, r.b, r.s = 3, 1.5, True, "xyz"
+    assert (r.base_value, r.d, r.d_readonly, r.b, r.s) == (3, 1.5, 1.5, True, "xyz")
+
+    for name in ("c", "d_readonly"):
+        with pytest.raises(AttributeError) as excinfo:
+            setattr(r, name, 8)
+        assert "can't set attribute" in str(excinfo.value)
+    with pytest.raises(AttributeError) as excinfo:
+        del r.d
+    assert "can't delete attribute" in str(excinfo.value)
+    with pytest.raises(TypeError) as excinfo:
+        r.d = "1.0"
+    assert "incompatible value of type 'str' (expected float)" in str(excinfo.value)
+    assert r.d == 1.5
+
+    c = m.MemberRecordChild()
+    c.base_value, c.s, c.child_value = 4, "child", 5
+    assert (c.base_value, c.s, c.child_value) == (4, "child", 5)
+
+    class PySubclass(m.MemberRecord):
+        pass
+
+    p = PySubclass()
+    p.d = 2.5
+    assert p.d == 2.5
+
+    descr = m.MemberRecord.__dict__["d"]
+    assert type(descr).__name__ == "pybind11_member"
+    assert descr.__get__(r) == 1.5
+    with pytest.raises(TypeError) as excinfo:
+        descr.__get__(m.TestProperties())
+    assert "doesn't apply to a" in str(excinfo.value)
+
+    # fget and fset like a property, with the same docstrings
+    assert descr.fget is descr.fget
+    descr.fset(r, 3.5)
+    assert descr.fget(r) == 3.5
+    assert m.MemberRecord.__dict__["c"].fset is None
+    assert descr.__doc__ == descr.fget.__doc__
+    assert descr.fget.__doc__.startswith("(self: ")
+    assert descr.fget.__doc__.endswith(") -> float\n")
+    assert descr.fset.__doc__.endswith(", arg0: float) -> None\n")
+
+    # def_readwrite uses the descriptor too, unless given extra attributes
+    assert type(m.MemberRecord.__dict__["s_readwrite"]).__name__ == "pybind11_member"
+    assert r.s_readwrite == "xyz"
+    prop = m.MemberRecord.__dict__["s_property"]
+    assert isinstance(prop, property)
+    assert prop.__doc__ == "s as a property"
+    assert prop.fget.__doc__.startswith("(self: ")
+
+
 def test_static_properties():
     assert m.TestProperties.def_readonly_static == 1
     with pytest.raises(AttributeError) as excinfo:
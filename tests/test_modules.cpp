@@ -98,4 +98,51 @@ TEST_SUBMODULE(modules, m) {
 
         return failures;
     });
+
+    // test_import_profile
+    m.def("profile_init", [m](py::list records) mutable {
+        auto builtins = py::module_::import(PYBIND11_BUILTINS_MODULE);
+        builtins.attr("__pybind11_import_profile__") = records;
+        {
+            // As done by PYBIND11_MODULE
+            py::detail::import_profile_module profile("profiled");
+            auto pm = m.def_submodule("profiled");
+            pm.def("function", []() {});
+            struct Profiled {
+                static int value() { return 1; }
+            };
+            py::class_<Profiled>(pm, "Profiled")
+                .def(py::init<>())
+                .def_static("value", &Profiled::value);
+        }
+        py::delattr(builtins, "__pybind11_import_profile__");
+        // Not recorded anymore
+        m.attr("profiled").cast<py::module_>().def("unprofiled", []() {});
+    });
+
+    // test_lazy_class
+    struct LazyA { int value = 1; };
+    struct LazyB { int value = 2; };
+    auto lm = m.def_submodule("lazy");
+    lm.def_lazy_class<LazyA>("LazyA", [](py::module_ &lm) {
+        py::class_<LazyA>(lm, "LazyA")
+            .def(py::init<>())
+            .def_readonly("value", &LazyA::value);
+    });
+    lm.def_lazy_class<LazyB>("LazyB", [](py::module_ &lm) {
+        py::class_<LazyB>(lm, "LazyB")
+            .def_readonly("value", &LazyB::value);
+    });
+    lm.def("get_value", [](const LazyA &a) { return a.value; });
+    lm.def("make_b", []() { return LazyB(); });
+#if PY_VERSION_HEX >= 0x03070000
+    // Bindings that fail (they would be called right away on older versions)
+    struct LazyFailing {};
+    struct LazyUnbound {};
+    lm.def_lazy_class<LazyFailing>("LazyFailing", [](py::module_ &) {
+        throw std::runtime_error("binding failed");
+    });
+    lm.def_lazy_class<LazyUnbound>("LazyUnbound", [](py::module_ &) {});
+    lm.def("make_failing", []() { return LazyFailing(); });
+#endif
 }
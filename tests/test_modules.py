@@ -1,4 +1,8 @@
 # -*- coding: utf-8 -*-
+import sys
+
+import pytest
+
 from pybind11_tests import modules as m
 from pybind11_tests.modules import subsubmodule as ms
 from pybind11_tests import ConstructorStats
@@ -75,3 +79,73 @@ def test_duplicate_registration():
     """Registering two things with the same name"""
 
     assert m.duplicate_registration() == []
+
+
+def test_import_profile():
+    records = []
+    m.profile_init(records)
+    assert [r[:2] for r in records] == [
+        ("function", "pybind11_tests.modules.profiled.function"),
+        ("class", "pybind11_tests.modules.profiled.Profiled"),
+        ("method", "pybind11_tests.modules.profiled.Profiled.__init__"),
+        ("method", "pybind11_tests.modules.profiled.Profiled.value"),
+        ("module", "profiled"),
+    ]
+    for kind, name, seconds, blocks in records:
+        assert seconds >= 0
+        assert isinstance(blocks, int)
+    assert m.profiled.Profiled.value() == 1
+
+
+def test_lazy_class():
+    lm = m.lazy
+    if sys.version_info >= (3, 7):
+        assert "LazyA" not in vars(lm)
+        assert "LazyB" not in vars(lm)
+        assert {"LazyA", "LazyB", "get_value"} <= set(dir(lm))
+    # Signatures don't bind lazy classes
+    assert lm.get_value.__doc__.startswith(
+        "get_value(arg0: pybind11_tests.modules.lazy.LazyA) -> int"
+    )
+    if sys.version_info >= (3, 7):
+        assert "LazyA" not in vars(lm)
+
+    # Bound on first access
+    a = lm.LazyA()
+    assert "LazyA" in vars(lm)
+    assert lm.get_value(a) == 1
+
+    # Bound when an instance is cast to Python
+    b = lm.make_b()
+    assert "LazyB" in vars(lm)
+    assert type(b) is lm.LazyB
+    assert b.value == 2
+
+    with pytest.raises(AttributeError) as excinfo:
+        lm.LazyC
+    assert "has no attribute 'LazyC'" in str(excinfo.value)
+
+
+@pytest.mark.skipif(sys.version_info < (3, 7), reason="requires Python 3.7+")
+def test_lazy_class_failures():
+    lm = m.lazy
+    with pytest.raises(RuntimeError) as excinfo:
+        lm.make_failing()
+    assert (
+        'could not bind "pybind11_tests.modules.lazy.LazyFailing"'
+        in str(excinfo.value)
+    )
+    assert "binding failed" in str(excinfo.value)
+    # Not bound lazily anymore
+    with pytest.raises(AttributeError):
+        lm.LazyFailing
+    assert "LazyFailing" not in dir(lm)
+    with pytest.raises(TypeError) as excinfo:
+        lm.make_failing()
+    assert "Unable to convert function return value" in str(excinfo.value)
+
+    with pytest.raises(RuntimeError) as excinfo:
+        lm.LazyUnbound
+    assert 'the binding of "LazyUnbound" did not bind its type' in str(excinfo.value)
+    with pytest.raises(AttributeError):
+        lm.LazyUnbound
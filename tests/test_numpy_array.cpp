@@ -129,6 +129,21 @@ template <typename T, typename T2> py::handle auxiliaries(T &&r, T2 &&r2) {
     return l.release();
 }
 
+// Counts the live allocations it made
+template <typename T> struct CountingAllocator : std::allocator<T> {
+    static int live;
+    template <typename U> struct rebind { using other = CountingAllocator<U>; };
+    CountingAllocator() = default;
+    template <typename U> CountingAllocator(const CountingAllocator<U> &) { }
+    T *allocate(size_t n) { ++live; return std::allocator<T>::allocate(n); }
+    void deallocate(T *p, size_t n) { --live; std::allocator<T>::deallocate(p, n); }
+};
+template <typename T> int CountingAllocator<T>::live = 0;
+
+struct SharedGrid {
+    py::array_t<double> values;
+};
+
 // note: declaration at local scope would create a dangling reference!
 static int data_i = 42;
 
@@ -437,4 +452,103 @@ TEST_SUBMODULE(numpy_array, sm) {
     sm.def("accept_double_f_style_forcecast_noconvert",
            [](py::array_t<double, py::array::forcecast | py::array::f_style>) {},
            "a"_a.noconvert());
+
+    // test_shared_memory
+    sm.def("shared_array", [](ssize_t rows, ssize_t cols) {
+        auto a = py::array_t<double>::shared({rows, cols});
+        auto r = a.mutable_unchecked<2>();
+        for (ssize_t i = 0; i < rows; i++)
+            for (ssize_t j = 0; j < cols; j++)
+                r(i, j) = double(i * cols + j);
+        return a;
+    });
+    sm.def("shared_array_f", [](ssize_t rows, ssize_t cols) {
+        return py::array_t<double, py::array::f_style>::shared({rows, cols});
+    });
+    sm.def("is_shared_memory", [](const py::array &a) { return a.is_shared_memory(); });
+    sm.def("shared_memory_descriptor", [](const py::array &a) { return a.shared_memory_descriptor(); });
+    sm.def("from_shared_memory", [](py::handle d) { return py::array::from_shared_memory(d); });
+    sm.def("from_shared_memory_c_style", [](py::handle d) {
+        return py::array_t<double, py::array::c_style>::from_shared_memory(d);
+    });
+
+    // test_from_mmap
+    py::enum_<py::array::mmap_advice>(sm, "MmapAdvice")
+        .value("normal", py::array::mmap_advice::normal)
+        .value("sequential", py::array::mmap_advice::sequential)
+        .value("random", py::array::mmap_advice::random);
+    sm.def("from_mmap",
+           [](const std::string &path, py::object dt, std::vector<ssize_t> shape, ssize_t offset,
+              const std::string &mode, py::array::mmap_advice advice) {
+               return py::array::from_mmap(path, py::dtype::from_args(dt), shape, offset, mode, advice);
+           },
+           "path"_a, "dtype"_a, "shape"_a = std::vector<ssize_t>{}, "offset"_a = 0, "mode"_a = "r",
+           "advice"_a = py::array::mmap_advice::normal);
+    sm.def("from_mmap_int32", [](const std::string &path, ssize_t offset) {
+        return py::array_t<int32_t>::from_mmap(path, {}, offset);
+    });
+
+    // test_allocator
+    sm.def("aligned_array", [](ssize_t rows, ssize_t cols) {
+        py::array_t<float> a({rows, cols}, py::aligned_allocator<float, 64>());
+        auto r = a.mutable_unchecked<2>();
+        for (ssize_t i = 0; i < rows; i++)
+            for (ssize_t j = 0; j < cols; j++)
+                r(i, j) = float(i * cols + j);
+        return py::make_tuple(a, reinterpret_cast<std::uintptr_t>(a.data()) % 64);
+    });
+    sm.def("aligned_array_f", [](ssize_t rows, ssize_t cols) {
+        return py::array_t<float, py::array::f_style>({rows, cols}, py::aligned_allocator<float, 4096>());
+    });
+    sm.def("counting_allocator_array", [](ssize_t n) {
+        return py::array_t<int>(n, CountingAllocator<char>());
+    });
+    sm.def("counting_allocator_live", []() { return CountingAllocator<int>::live; });
+
+    // test_parallel_for
+    sm.def("parallel_fill", [](py::array_t<double> a, ssize_t grain, size_t threads) {
+        py::parallel_for<2>(a, [](py::detail::unchecked_mutable_reference<double, 2> &rows, ssize_t begin) {
+            for (ssize_t i = 0; i < rows.shape(0); i++)
+                for (ssize_t j = 0; j < rows.shape(1); j++)
+                    rows(i, j) = double((begin + i) * rows.shape(1) + j);
+        }, grain, threads);
+    });
+    sm.def("parallel_block_rows", [](py::array_t<ssize_t> a, ssize_t grain, size_t threads) {
+        py::parallel_for<1>(a, [](py::detail::unchecked_mutable_reference<ssize_t, 1> &rows, ssize_t) {
+            for (ssize_t i = 0; i < rows.shape(0); i++)
+                rows(i) = rows.shape(0);
+        }, grain, threads);
+    });
+    sm.def("parallel_check_non_negative", [](const py::array_t<double> &a, size_t threads) {
+        py::parallel_for(a, [](const py::detail::unchecked_reference<double, -1> &rows, ssize_t begin) {
+            for (ssize_t i = 0; i < rows.shape(0); i++)
+                if (rows(i, 0) < 0)
+                    throw std::domain_error("negative value in row " + std::to_string(begin + i));
+        }, 1, threads);
+    });
+    sm.def("parallel_sum", [](const py::array_t<double> &a, size_t threads) {
+        return py::parallel_reduce(
+            a, 0.0,
+            [](const py::detail::unchecked_reference<double, -1> &rows, ssize_t, double &acc) {
+                for (ssize_t i = 0; i < rows.shape(0); i++)
+                    for (ssize_t j = 0; j < rows.shape(1); j++)
+                        acc += rows(i, j);
+            },
+            [](double x, double y) { return x + y; }, 1, threads);
+    });
+
+    // test_parallel_first_touch
+    sm.def("parallel_first_touch", [](py::array_t<double> a, size_t threads) {
+        py::parallel_first_touch(a, 1, threads);
+    });
+
+    // test_shared_memory_pickle
+    py::class_<SharedGrid>(sm, "SharedGrid")
+        .def(py::init([](ssize_t rows, ssize_t cols) {
+            return SharedGrid{py::array_t<double>::shared({rows, cols})};
+        }))
+        .def_readonly("values", &SharedGrid::values)
+        .def(py::pickle(
+            [](const SharedGrid &g) { return g.values.shared_memory_descriptor(); },
+            [](py::object state) { return SharedGrid{py::array_t<double>::from_shared_memory(state)}; }));
 }
@@ -1,4 +1,8 @@
 # -*- coding: utf-8 -*-
+import gc
+import pickle
+import sys
+
 import pytest
 
 import env  # noqa: F401
@@ -539,3 +543,183 @@ def test_dtype_refcount_leak():
     m.ndim(a)
     after = getrefcount(dtype)
     assert after == before
+
+
+def test_from_mmap(tmp_path):
+    path = str(tmp_path / "data")
+    np.arange(24, dtype=np.float64).tofile(path)
+
+    a = m.from_mmap(path, np.float64)
+    assert np.array_equal(a, np.arange(24.0))
+    assert not a.flags.writeable
+    with pytest.raises(ValueError):
+        a[0] = 1
+
+    b = m.from_mmap(path, np.float64, [2, 3], offset=8 * 3)
+    assert np.array_equal(b, np.arange(3.0, 9.0).reshape(2, 3))
+
+    c = m.from_mmap(path, "float64", [4], offset=8, mode="c", advice=m.MmapAdvice.random)
+    c[:] = -1
+    assert np.array_equal(np.fromfile(path), np.arange(24.0))
+
+    d = m.from_mmap(path, np.float64, [3, 2], mode="r+", advice=m.MmapAdvice.sequential)
+    d[1, 1] = 42
+    del d
+    assert np.fromfile(path)[3] == 42
+
+    assert np.array_equal(m.from_mmap_int32(path, 8 * 23), np.arange(23.0, 24.0).view(np.int32))
+    assert m.from_mmap(path, np.float64, offset=8 * 24).shape == (0,)
+
+    with pytest.raises(ValueError) as excinfo:
+        m.from_mmap(path, np.float64, [25])
+    assert "file is too small" in str(excinfo.value)
+    with pytest.raises(ValueError) as excinfo:
+        m.from_mmap(path, np.float64, mode="w")
+    assert "invalid mmap mode" in str(excinfo.value)
+    with pytest.raises(IOError):
+        m.from_mmap(str(tmp_path / "missing"), np.float64)
+
+
+def test_allocator():
+    a, misalignment = m.aligned_array(3, 5)
+    assert misalignment == 0
+    assert a.flags.c_contiguous and a.flags.writeable
+    assert np.array_equal(a, np.arange(15, dtype=np.float32).reshape(3, 5))
+
+    f = m.aligned_array_f(4, 2)
+    assert f.flags.f_contiguous
+    assert f.ctypes.data % 4096 == 0
+    assert m.aligned_array(0, 5)[0].shape == (0, 5)
+
+    live = m.counting_allocator_live()
+    b = m.counting_allocator_array(10)
+    assert b.shape == (10,) and b.dtype == np.intc
+    view = b[::2]
+    del b
+    gc.collect()
+    assert m.counting_allocator_live() == live + 1
+    del view
+    gc.collect()
+    assert m.counting_allocator_live() == live
+
+
+@pytest.mark.parametrize("threads", [0, 1, 3, 16])
+def test_parallel_for(threads):
+    a = np.zeros((10, 3))
+    m.parallel_fill(a, 2, threads)
+    assert np.array_equal(a, np.arange(30.0).reshape(10, 3))
+    assert m.parallel_sum(a, threads) == sum(range(30))
+
+    b = np.zeros((10, 6))
+    view = b[::2, ::-2]
+    m.parallel_fill(view, 1, threads)
+    assert np.array_equal(view, np.arange(15.0).reshape(5, 3))
+    assert m.parallel_sum(view, threads) == sum(range(15))
+
+    # Each block has at least `grain` rows
+    rows = np.zeros(10, dtype=np.intp)
+    m.parallel_block_rows(rows, 3, threads)
+    assert rows.min() >= 3
+    m.parallel_block_rows(rows, 20, threads)
+    assert np.all(rows == 10)
+
+    empty = np.zeros((0, 3))
+    m.parallel_fill(empty, 1, threads)
+    assert m.parallel_sum(empty, threads) == 0
+
+    m.parallel_check_non_negative(a, threads)
+    a[7, 0] = -1
+    with pytest.raises(ValueError) as excinfo:
+        m.parallel_check_non_negative(a, threads)
+    assert str(excinfo.value) == "negative value in row 7"
+
+    a.flags.writeable = False
+    with pytest.raises(ValueError) as excinfo:
+        m.parallel_fill(a, 1, threads)
+    assert "not writeable" in str(excinfo.value)
+
+
+@pytest.mark.parametrize("threads", [0, 1, 3])
+def test_parallel_first_touch(threads):
+    a = np.full((7, 3), 5.0)
+    m.parallel_first_touch(a, threads)
+    assert np.array_equal(a, np.zeros((7, 3)))
+
+    with pytest.raises(ValueError) as excinfo:
+        m.parallel_first_touch(np.full((7, 3), 5.0, order="F"), threads)
+    assert "C-contiguous" in str(excinfo.value)
+
+
+def test_shared_memory():
+    shared_memory = pytest.importorskip("multiprocessing.shared_memory")
+
+    a = m.shared_array(3, 4)
+    assert np.array_equal(a, np.arange(12.0).reshape(3, 4))
+    assert m.is_shared_memory(a)
+    assert m.is_shared_memory(a[1:, ::2])
+    assert not m.is_shared_memory(np.zeros(3))
+
+    descriptor = pickle.loads(pickle.dumps(m.shared_memory_descriptor(a)))
+    b = m.from_shared_memory(descriptor)
+    assert np.array_equal(a, b)
+    b[0, 0] = 42
+    assert a[0, 0] == 42
+
+    view = a[::-1, 1::2]
+    assert np.array_equal(m.from_shared_memory(m.shared_memory_descriptor(view)), view)
+
+    f = m.shared_array_f(2, 3)
+    assert f.flags.f_contiguous
+    assert m.is_shared_memory(f)
+    with pytest.raises(TypeError) as excinfo:
+        m.from_shared_memory_c_style(m.shared_memory_descriptor(f))
+    assert "incompatible dtype or layout" in str(excinfo.value)
+
+    with pytest.raises(ValueError) as excinfo:
+        m.shared_memory_descriptor(np.zeros(3))
+    assert "not in shared memory" in str(excinfo.value)
+    name, dtype, _, _, _ = descriptor
+    with pytest.raises(ValueError) as excinfo:
+        m.from_shared_memory((name, dtype, (1000,), (8,), 0))
+    assert "invalid shared memory descriptor" in str(excinfo.value)
+
+    # The creating process unlinks the segment once its arrays are gone
+    del a, b, view, excinfo
+    gc.collect()
+    with pytest.raises(FileNotFoundError):
+        shared_memory.SharedMemory(name)
+
+
+@pytest.mark.skipif(sys.version_info >= (3, 13), reason="attaching doesn't track segments")
+def test_shared_memory_tracking():
+    shared_memory = pytest.importorskip("multiprocessing.shared_memory")
+    from multiprocessing import resource_tracker
+
+    # A segment created by another process, as far as pybind11 is concerned
+    shm = shared_memory.SharedMemory(create=True, size=16)
+    tracked = set()
+    register, unregister = resource_tracker.register, resource_tracker.unregister
+    resource_tracker.register = lambda name, rtype: tracked.add(name)
+    resource_tracker.unregister = lambda name, rtype: tracked.discard(name)
+    try:
+        a = m.from_shared_memory((shm.name, np.dtype("float64"), (2,), (8,), 0))
+        a[1] = 1.5
+        # Otherwise, the resource tracker would unlink the segment when this process exits
+        assert not tracked
+    finally:
+        resource_tracker.register, resource_tracker.unregister = register, unregister
+    assert np.ndarray((2,), buffer=shm.buf)[1] == 1.5
+    del a
+    shm.close()
+    shm.unlink()
+
+
+def test_shared_memory_pickle():
+    pytest.importorskip("multiprocessing.shared_memory")
+
+    g = m.SharedGrid(2, 2)
+    g.values[:] = 1
+    h = pickle.loads(pickle.dumps(g))
+    assert np.array_equal(h.values, g.values)
+    h.values[1, 1] = 5
+    assert g.values[1, 1] == 5
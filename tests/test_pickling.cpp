@@ -8,6 +8,7 @@
 */
 
 #include "pybind11_tests.h"
+#include <vector>
 
 TEST_SUBMODULE(pickling, m) {
     // test_roundtrip
@@ -135,4 +136,69 @@ TEST_SUBMODULE(pickling, m) {
             }
         ));
 #endif
+
+    // test_pickle_protocol
+    class Blob {
+    public:
+        explicit Blob(std::vector<double> values) : storage(std::move(values)), data(storage.data()), size(storage.size()) { }
+        /// Uses the memory of `buffer` (without copying it)
+        explicit Blob(py::buffer buffer) : owner(buffer) {
+            auto info = buffer.request(true);
+            data = static_cast<double *>(info.ptr);
+            size = (size_t) (info.size * info.itemsize) / sizeof(double);
+        }
+
+        std::vector<double> storage;
+        py::object owner;
+        double *data;
+        size_t size;
+    };
+
+    py::class_<Blob>(m, "Blob")
+        .def(py::init([](const py::iterable &values) {
+            std::vector<double> storage;
+            for (auto value : values)
+                storage.push_back(value.cast<double>());
+            return Blob(std::move(storage));
+        }))
+        .def("values", [](const Blob &b) {
+            py::list values;
+            for (size_t i = 0; i < b.size; ++i)
+                values.append(b.data[i]);
+            return values;
+        })
+        .def("set", [](Blob &b, size_t i, double value) { b.data[i] = value; })
+        .def("adopted", [](const Blob &b) { return (bool) b.owner; })
+        .def(py::pickle(
+            [](py::object self, int protocol) -> py::buffer {
+                auto &b = self.cast<const Blob &>();
+#if defined(PYBIND11_HAS_PICKLE_BUFFER)
+                if (protocol >= 5)
+                    return py::pickle_buffer(py::buffer_info(b.data, (py::ssize_t) b.size), self);
+#else
+                (void) protocol;
+#endif
+                return py::bytes(reinterpret_cast<const char *>(b.data), b.size * sizeof(double));
+            },
+            [](py::buffer state) {
+                // Bytes (from older protocols) can't be adopted, since they are immutable
+                if (state.request().readonly) {
+                    auto info = state.request();
+                    auto data = static_cast<const double *>(info.ptr);
+                    return Blob(std::vector<double>(data, data + info.size / (py::ssize_t) sizeof(double)));
+                }
+                return Blob(state);
+            }
+        ));
+
+#if defined(PYBIND11_HAS_PICKLE_BUFFER)
+    // test_pickle_buffer_strided
+    m.def("strided_pickle_buffer", []() {
+        // Every other value
+        static double values[] = {1.0, 2.0, 3.0, 4.0, 5.0, 6.0};
+        return py::pickle_buffer(py::buffer_info(values, sizeof(double), py::format_descriptor<double>::format(),
+                                                 1, {3}, {2 * sizeof(double)}, true),
+                                 py::none());
+    });
+#endif
 }
@@ -1,4 +1,7 @@
 # -*- coding: utf-8 -*-
+import array
+import sys
+
 import pytest
 
 import env  # noqa: F401
@@ -45,3 +48,46 @@ def test_enum_pickle():
 
     data = pickle.dumps(e.EOne, 2)
     assert e.EOne == pickle.loads(data)
+
+
+@pytest.mark.parametrize("protocol", [2, pickle.HIGHEST_PROTOCOL])
+def test_pickle_protocol(protocol):
+    b = m.Blob([1.0, 2.0, 3.0])
+    b2 = pickle.loads(pickle.dumps(b, protocol))
+    assert b2.values() == [1.0, 2.0, 3.0]
+    # In-band data is copied
+    b.set(0, 4.0)
+    assert b2.values() == [1.0, 2.0, 3.0]
+    assert b2.adopted() == (protocol >= 5 and not env.PYPY)
+
+
+@pytest.mark.skipif("env.PYPY or sys.version_info < (3, 8)")
+def test_pickle_buffer():
+    b = m.Blob([1.0, 2.0, 3.0])
+    buffers = []
+    data = pickle.dumps(b, 5, buffer_callback=buffers.append)
+    assert len(buffers) == 1
+    assert memoryview(buffers[0]).tolist() == [1.0, 2.0, 3.0]
+
+    # The out-of-band buffer refers to the memory of `b`, which the copy adopts
+    b2 = pickle.loads(data, buffers=buffers)
+    assert b2.adopted()
+    assert b2.values() == [1.0, 2.0, 3.0]
+    b.set(1, 5.0)
+    assert b2.values() == [1.0, 5.0, 3.0]
+
+    # The buffers keep `b` alive
+    del b, buffers
+    assert b2.values() == [1.0, 5.0, 3.0]
+
+
+@pytest.mark.skipif("env.PYPY or sys.version_info < (3, 8)")
+def test_pickle_buffer_strided():
+    buffer = m.strided_pickle_buffer()
+    assert memoryview(buffer).tolist() == [1.0, 3.0, 5.0]
+    # Consumers that don't handle strides can't use it
+    with pytest.raises(BufferError) as excinfo:
+        array.array("d").frombytes(buffer)
+    assert "discontiguous" in str(excinfo.value)
+    with pytest.raises(BufferError):
+        buffer.raw()
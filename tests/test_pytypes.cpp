@@ -149,6 +149,9 @@ TEST_SUBMODULE(pytypes, m) {
 
         d["attr(object)"] = o.attr("sub").attr("attr_obj");
         d["attr(char *)"] = o.attr("sub").attr("attr_char");
+        static const py::interned_str attr_interned("attr_obj");
+        d["attr(interned_str)"] = o.attr("sub").attr(attr_interned);
+        d["hasattr(interned_str)"] = py::hasattr(o.attr("sub"), attr_interned);
         try {
             o.attr("sub").attr("missing").ptr();
         } catch (const py::error_already_set &) {
@@ -200,6 +200,8 @@ def test_accessors():
     assert d["operator[char *]"] == 2
     assert d["attr(object)"] == 1
     assert d["attr(char *)"] == 2
+    assert d["attr(interned_str)"] == 1
+    assert d["hasattr(interned_str)"] is True
     assert d["missing_attr_ptr"] == "raised"
     assert d["missing_attr_chain"] == "raised"
     assert d["is_none"] is False
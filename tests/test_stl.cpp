@@ -38,6 +38,22 @@ struct visit_helper<boost::variant> {
 
 PYBIND11_MAKE_OPAQUE(std::vector<std::string, std::allocator<std::string>>);
 
+/// Registered type with a caster that overrides casting rvalues
+struct TaggedValue {
+    int value;
+};
+
+namespace pybind11 { namespace detail {
+template <>
+struct type_caster<TaggedValue> : type_caster_base<TaggedValue> {
+    using type_caster_base<TaggedValue>::cast;
+    static handle cast(TaggedValue &&src, return_value_policy policy, handle parent) {
+        src.value += 100;
+        return type_caster_base<TaggedValue>::cast(std::move(src), policy, parent);
+    }
+};
+}} // namespace pybind11::detail
+
 /// Issue #528: templated constructor
 struct TplCtorClass {
     template <typename T> TplCtorClass(const T &) { }
@@ -150,6 +166,33 @@ TEST_SUBMODULE(stl, m) {
         .def(py::init<>())
         .def_property_readonly("move_list", &MoveOutContainer::move_list);
 
+    // test_vector_of_bound_values
+    struct BoundValue {
+        int value;
+        explicit BoundValue(int value) : value(value) { print_created(this, value); }
+        BoundValue(const BoundValue &o) : value(o.value) { print_copy_created(this); }
+        BoundValue(BoundValue &&o) noexcept : value(o.value) { print_move_created(this); }
+        ~BoundValue() { print_destroyed(this); }
+    };
+    py::class_<BoundValue>(m, "BoundValue")
+        .def_readonly("value", &BoundValue::value);
+    m.def("make_bound_values", [](int n) {
+        std::vector<BoundValue> v;
+        v.reserve((size_t) n);
+        for (int i = 0; i < n; i++)
+            v.emplace_back(i);
+        return v;
+    });
+    static std::vector<BoundValue> *lv_bound_values = nullptr;
+    m.def("lv_bound_values", []() -> const std::vector<BoundValue> & {
+        if (!lv_bound_values)
+            lv_bound_values = new std::vector<BoundValue>{BoundValue(10), BoundValue(11)};
+        return *lv_bound_values;
+    }, py::return_value_policy::copy);
+    py::class_<TaggedValue>(m, "TaggedValue")
+        .def_readonly("value", &TaggedValue::value);
+    m.def("make_tagged_values", []() { return std::vector<TaggedValue>{{1}, {2}}; });
+
     // Class that can be move- and copy-constructed, but not assigned
     struct NoAssign {
         int value;
@@ -248,6 +291,8 @@ TEST_SUBMODULE(stl, m) {
         result_type operator()(std::string) { return "std::string"; }
         result_type operator()(double) { return "double"; }
         result_type operator()(std::nullptr_t) { return "std::nullptr_t"; }
+        result_type operator()(bool) { return "bool"; }
+        result_type operator()(const UserType &) { return "UserType"; }
     };
 
     // test_variant
@@ -257,6 +302,9 @@ TEST_SUBMODULE(stl, m) {
     m.def("load_variant_2pass", [](variant<double, int> v) {
         return py::detail::visit_helper<variant>::call(visitor(), v);
     });
+    m.def("load_variant_dispatch", [](variant<bool, int, double, std::string, UserType> v) {
+        return py::detail::visit_helper<variant>::call(visitor(), v);
+    });
     m.def("cast_variant", []() {
         using V = variant<int, std::string>;
         return py::make_tuple(V(5), V("Hello"));
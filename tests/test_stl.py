@@ -106,6 +106,25 @@ def test_move_out_container():
     assert [x.value for x in moved_out_list] == [0, 1, 2]
 
 
+def test_vector_of_bound_values():
+    """Elements of a temporary vector of a registered type are moved into new instances"""
+    cstats = ConstructorStats.get(m.BoundValue)
+    values = m.make_bound_values(5)
+    assert [x.value for x in values] == [0, 1, 2, 3, 4]
+    assert cstats.move_constructions == 5
+    assert cstats.copy_constructions == 0
+    assert cstats.alive() == 5
+
+    lv = m.lv_bound_values()
+    assert [x.value for x in lv] == [10, 11]
+    assert cstats.copy_constructions >= 2
+    del values, lv
+    assert cstats.alive() == 2  # the static vector
+
+    # Custom casters deriving from type_caster_base keep the element-wise path
+    assert [x.value for x in m.make_tagged_values()] == [101, 102]
+
+
 @pytest.mark.skipif(not hasattr(m, "has_optional"), reason="no <optional>")
 def test_optional():
     assert m.double_or_zero(None) == 0
@@ -174,6 +193,26 @@ def test_variant(doc):
 
     assert m.cast_variant() == (5, "Hello")
 
+    class SubUserType(UserType):
+        pass
+
+    class Index(object):
+        pass
+
+    # Repeat to use the per-type dispatch table of the caster
+    for _ in range(2):
+        assert m.load_variant_dispatch(True) == "bool"
+        assert m.load_variant_dispatch(1) == "int"
+        assert m.load_variant_dispatch(1.5) == "double"
+        assert m.load_variant_dispatch("1") == "std::string"
+        assert m.load_variant_dispatch(b"1") == "std::string"
+        assert m.load_variant_dispatch(UserType(1)) == "UserType"
+        assert m.load_variant_dispatch(SubUserType(2)) == "UserType"
+        with pytest.raises(TypeError):
+            m.load_variant_dispatch(Index())
+    Index.__index__ = lambda self: 3
+    assert m.load_variant_dispatch(Index()) == "int"
+
     assert (
         doc(m.load_variant) == "load_variant(arg0: Union[int, str, float, None]) -> str"
     )